@@ -127,9 +127,11 @@
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
-#define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_BUFFERS               3      // Default number of batch buffers (multi-buffering, drawn in a ring)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+//#define RLGL_ENABLE_BATCH_INTERLEAVED         1      // Store batch vertex data interleaved in a single vertex buffer, uploaded at once
+#define RL_DEFAULT_BATCH_VERTEX_NORMALS        1      // Store normals on interleaved batch vertex data, required by lighting shaders
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
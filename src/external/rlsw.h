@@ -10,17 +10,24 @@
 * 
 *   FEATURES:
 *       - Rendering to custom internal framebuffer with multiple color modes supported:
-*           - Color buffer: RGB - 8-bit (3:3:2) | RGB - 16-bit (5:6:5) | RGB - 24-bit (8:8:8)
+*           - Color buffer: RGB - 8-bit (3:3:2) | RGB - 16-bit (5:6:5) | RGB - 24-bit (8:8:8) | RGBA - 32-bit (8:8:8:8)
 *           - Depth buffer: D - 8-bit (unorm) | D - 16-bit (unorm) | D - 24-bit (unorm)
+*       - Framebuffer objects, rendering directly into textures (color and optional depth attachments)
+*       - Dirty region tracking for partial presentation, optional partial clear of the modified region
+*       - Asynchronous presentation, framebuffer conversion overlapped with the next frame rendering
+*       - External color buffer memory (e.g. scanout buffers), rendering without any framebuffer copy
 *       - Rendering modes supported: POINT, LINES, TRIANGLE, QUADS
 *           - Additional features: Polygon modes, Point width, Line width
 *       - Clipping support for all rendering modes
 *       - Texture features supported:
 *           - All uncompressed texture formats supported by raylib
 *           - Texture Minification/Magnification checks
-*           - Point and Bilinear filtering
+*           - Point and Bilinear filtering (fixed-point for RGBA8 textures)
+*           - Mipmaps (uploaded per level or generated) with nearest-mip and trilinear filtering
 *           - Texture Wrap Modes with separate checks for S/T coordinates
 *       - Vertex Arrays support with direct primitive drawing mode
+*           - Indexed drawing (glDrawElements) with a post-transform vertex cache
+*           - Arrays transformed in bulk (SoA, vectorized) before primitive assembly
 *       - Matrix Stack support (Matrix Push/Pop)
 *       - Other GL misc features:
 *           - GL-style getter functions
@@ -30,6 +37,10 @@
 *           - Depth testing
 *           - Blend modes
 *           - Face culling
+*           - Anti-aliasing (GL_MULTISAMPLE), analytic edge coverage resolved when the framebuffer is read
+*       - Optional tile-binned rasterization distributed over a pool of worker threads
+*       - Optional multiple contexts, rendering independent scenes on different threads with shared textures
+*       - SIMD span rasterization (SSE2, AVX2 or NEON) with scalar fallback
 *
 *   ADDITIONAL NOTES:
 *       Check PR for more info: https://github.com/raysan5/raylib/pull/4832
@@ -51,6 +62,65 @@
 *           #define SW_MAX_MODELVIEW_STACK_SIZE     8
 *           #define SW_MAX_TEXTURE_STACK_SIZE       2
 *           #define SW_MAX_TEXTURES                 128
+*           #define SW_MAX_FRAMEBUFFERS             16
+*           #define SW_VERTEX_BATCH_SIZE            3072    // Vertices transformed per pass by swDrawArrays(), multiple of 12
+*           #define SW_MAX_AA_EDGES                 8192    // Polygon edges anti-aliased per pass with SW_MULTISAMPLE
+*
+*           #define SW_TEXTURE_CONVERT              true
+*               Textures are converted at upload to RGBA8 (grayscale textures are kept as is), so sampling
+*               does not decode packed, half or float formats on every fetch. Textures referencing the
+*               caller's data in another format get their own storage, disable it to keep the original
+*               formats and references when memory is constrained (float values are clamped to [0..1])
+*
+*           #define SW_TEXTURE_TILED                false
+*               Textures copied at upload and generated mipmaps are stored in 4x4 texel blocks,
+*               neighboring rows of texels share cache lines (rotated sprites, perspective floors).
+*               Textures referencing the caller's data are left as is, and are restored in
+*               rows when attached to a framebuffer object
+*
+*           #define SW_CLIP_GUARD_BAND              4.0f
+*               Polygons are only clipped against the x/y planes once they leave an area this many
+*               times larger than the viewport, the viewport and scissor are applied when rasterizing
+*
+*           #define SW_COLOR_BUFFER_BGRA            SW_GL_FRAMEBUFFER_COPY_BGRA
+*               With a 32-bit color buffer (destination alpha available), pixels are stored in BGRA order,
+*               matching the framebuffer copies output so presenting it is a plain memory copy
+*
+*           #define SW_ENABLE_SIMD                  true
+*               Spans are rasterized several pixels at a time using the SIMD instruction set
+*               enabled for the target (AVX2: 8 pixels, SSE2/NEON: 4 pixels), if any
+*
+*           #define SW_ENABLE_HIZ                   true
+*               A coarse depth buffer keeps the farthest depth of each tile of the framebuffer,
+*               triangles, spans and quads entirely behind it are rejected before being shaded
+*           #define SW_HIZ_TILE_SIZE                8       // Power of two, divides SW_BINNING_TILE_SIZE
+*
+*           #define SW_ENABLE_BINNING               false
+*               Primitives are recorded into screen-space tiles and rasterized in parallel by a
+*               pool of worker threads when the bins are flushed (framebuffer copy/blit, texture
+*               updates or swFinish()). Requires pthreads (or C11 threads with MSVC)
+*               NOTE: Rasterizers evaluate edges and values at each row and pixel instead of stepping
+*               them, so the rendered image is the same with and without binning
+*           #define SW_BINNING_THREADS             0       // 0: use the number of online processors
+*           #define SW_BINNING_TILE_SIZE            64
+*           #define SW_MAX_BINNING_THREADS          16
+*
+*           #define SW_ENABLE_ASYNC_PRESENT         false
+*               swPresentFramebuffer() snapshots the presented region and converts it into the
+*               destination on a dedicated thread, while the next frame is being rendered.
+*               Requires pthreads (or C11 threads with MSVC), presentation is synchronous otherwise
+*
+*           #define SW_ENABLE_CONTEXTS              false
+*               Additional contexts can be created with swCreateContext() and made current per thread
+*               with swMakeCurrent(), so independent scenes are rendered concurrently. Contexts created
+*               with a share context use the same texture objects. Requires pthreads (or C11 threads
+*               with MSVC), the current context is looked up through a thread-local pointer
+*               NOTE: A shared texture can only be attached to framebuffer objects of one context at
+*               a time, and only deleted from that context while attached (SW_INVALID_OPERATION)
+*
+*           #define SW_ENABLE_STATS                 false
+*               Primitives, fragments and texels are counted and the time spent clearing, rendering
+*               and copying the framebuffer is measured, queried with swGetStats()
 *
 * 
 *   LICENSE: MIT
@@ -123,6 +193,10 @@
     #define SW_COLOR_BUFFER_BITS            24
 #endif
 
+#ifndef SW_COLOR_BUFFER_BGRA
+    #define SW_COLOR_BUFFER_BGRA            SW_GL_FRAMEBUFFER_COPY_BGRA
+#endif
+
 #ifndef SW_DEPTH_BUFFER_BITS
     #define SW_DEPTH_BUFFER_BITS            16
 #endif
@@ -143,19 +217,83 @@
     #define SW_MAX_TEXTURES                 128
 #endif
 
+#ifndef SW_MAX_FRAMEBUFFERS
+    #define SW_MAX_FRAMEBUFFERS             16
+#endif
+
+#ifndef SW_VERTEX_BATCH_SIZE
+    #define SW_VERTEX_BATCH_SIZE            3072
+#endif
+
+#ifndef SW_MAX_AA_EDGES
+    #define SW_MAX_AA_EDGES                 8192
+#endif
+
+#ifndef SW_ENABLE_SIMD
+    #define SW_ENABLE_SIMD                  true
+#endif
+
+#ifndef SW_ENABLE_HIZ
+    #define SW_ENABLE_HIZ                   true
+#endif
+
+#ifndef SW_HIZ_TILE_SIZE
+    #define SW_HIZ_TILE_SIZE                8
+#endif
+
+#ifndef SW_ENABLE_BINNING
+    #define SW_ENABLE_BINNING               false
+#endif
+
+#ifndef SW_BINNING_THREADS
+    #define SW_BINNING_THREADS              0
+#endif
+
+#ifndef SW_BINNING_TILE_SIZE
+    #define SW_BINNING_TILE_SIZE            64
+#endif
+
+#ifndef SW_MAX_BINNING_THREADS
+    #define SW_MAX_BINNING_THREADS          16
+#endif
+
+#ifndef SW_ENABLE_ASYNC_PRESENT
+    #define SW_ENABLE_ASYNC_PRESENT         false
+#endif
+
+#ifndef SW_ENABLE_CONTEXTS
+    #define SW_ENABLE_CONTEXTS              false
+#endif
+
+#ifndef SW_ENABLE_STATS
+    #define SW_ENABLE_STATS                 false
+#endif
+
 // Under normal circumstances, clipping a polygon can add at most one vertex per clipping plane.
 // Considering the largest polygon involved is a quadrilateral (4 vertices),
-// and that clipping occurs against both the frustum (6 planes) and the scissors (4 planes),
+// and that clipping occurs against the w plane, the guard band (4 planes) and near/far (2 planes),
 // the maximum number of vertices after clipping is:
-// 4 (original vertices) + 6 (frustum planes) + 4 (scissors planes) = 14
+// 4 (original vertices) + 1 (w plane) + 4 (guard band planes) + 2 (near/far planes) = 11
 #ifndef SW_MAX_CLIPPED_POLYGON_VERTICES
-    #define SW_MAX_CLIPPED_POLYGON_VERTICES 14
+    #define SW_MAX_CLIPPED_POLYGON_VERTICES 11
 #endif
 
 #ifndef SW_CLIP_EPSILON
     #define SW_CLIP_EPSILON                 1e-4f
 #endif
 
+#ifndef SW_TEXTURE_CONVERT
+    #define SW_TEXTURE_CONVERT              true
+#endif
+
+#ifndef SW_TEXTURE_TILED
+    #define SW_TEXTURE_TILED                false
+#endif
+
+#ifndef SW_CLIP_GUARD_BAND
+    #define SW_CLIP_GUARD_BAND              4.0f
+#endif
+
 //----------------------------------------------------------------------------------
 // OpenGL Compatibility Types
 //----------------------------------------------------------------------------------
@@ -187,6 +325,7 @@ typedef double              GLclampd;
 #define GL_DEPTH_TEST                       0x0B71
 #define GL_CULL_FACE                        0x0B44
 #define GL_BLEND                            0x0BE2
+#define GL_MULTISAMPLE                      0x809D
 
 #define GL_VENDOR                           0x1F00
 #define GL_RENDERER                         0x1F01
@@ -222,6 +361,8 @@ typedef double              GLclampd;
 #define GL_TEXTURE_MATRIX                   0x0BA8
 #define GL_TEXTURE_STACK_DEPTH              0x0BA5
 #define GL_VIEWPORT                         0x0BA2
+#define GL_FRAMEBUFFER_BINDING              0x8CA6
+#define GL_DRAW_FRAMEBUFFER_BINDING         0x8CA6
 
 #define GL_COLOR_BUFFER_BIT                 0x00004000
 #define GL_DEPTH_BUFFER_BIT                 0x00000100
@@ -268,6 +409,10 @@ typedef double              GLclampd;
 
 #define GL_NEAREST                          0x2600
 #define GL_LINEAR                           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST           0x2700
+#define GL_LINEAR_MIPMAP_NEAREST            0x2701
+#define GL_NEAREST_MIPMAP_LINEAR            0x2702
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
 
 #define GL_REPEAT                           0x2901
 #define GL_CLAMP                            0x2900
@@ -291,6 +436,7 @@ typedef double              GLclampd;
 #define GL_LUMINANCE_ALPHA                  0x190A
 #define GL_RGB                              0x1907
 #define GL_RGBA                             0x1908
+#define GL_DEPTH_COMPONENT                  0x1902
 
 #define GL_BYTE                             0x1400
 #define GL_UNSIGNED_BYTE                    0x1401
@@ -299,11 +445,28 @@ typedef double              GLclampd;
 #define GL_INT                              0x1404
 #define GL_UNSIGNED_INT                     0x1405
 #define GL_FLOAT                            0x1406
+#define GL_UNSIGNED_SHORT_5_6_5             0x8363
+#define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
+#define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
+
+#define GL_FRAMEBUFFER                      0x8D40
+#define GL_COLOR_ATTACHMENT0                0x8CE0
+#define GL_DEPTH_ATTACHMENT                 0x8D00
+#define GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE   0x8CD0
+#define GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME   0x8CD1
+#define GL_NONE                             0
+
+#define GL_FRAMEBUFFER_COMPLETE                         0x8CD5
+#define GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT            0x8CD6
+#define GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT    0x8CD7
+#define GL_FRAMEBUFFER_UNSUPPORTED                      0x8CDD
+
+#define GL_PACK_ROW_LENGTH                  0x0D02
+#define GL_PACK_ALIGNMENT                   0x0D05
+#define GL_UNPACK_ALIGNMENT                 0x0CF5
 
 // OpenGL Definitions NOT USED
 #define GL_PERSPECTIVE_CORRECTION_HINT      0x0C50
-#define GL_PACK_ALIGNMENT                   0x0D05
-#define GL_UNPACK_ALIGNMENT                 0x0CF5
 #define GL_LINE_SMOOTH                      0x0B20
 #define GL_SMOOTH                           0x1D01
 #define GL_NICEST                           0x1102
@@ -324,6 +487,7 @@ typedef double              GLclampd;
 #define glReadPixels(x, y, w, h, f, t, p)           swCopyFramebuffer((x), (y), (w), (h), (f), (t), (p))
 #define glEnable(state)                             swEnable((state))
 #define glDisable(state)                            swDisable((state))
+#define glGetIntegerv(pname, params)                swGetIntegerv((pname), (params))
 #define glGetFloatv(pname, params)                  swGetFloatv((pname), (params))
 #define glGetString(pname)                          swGetString((pname))
 #define glGetError()                                swGetError()
@@ -374,24 +538,32 @@ typedef double              GLclampd;
 #define glTexCoordPointer(sz, t, s, p)              swBindArray(SW_TEXTURE_COORD_ARRAY, (p))
 #define glColorPointer(sz, t, s, p)                 swBindArray(SW_COLOR_ARRAY, (p))
 #define glDrawArrays(m, o, c)                       swDrawArrays((m), (o), (c))
+#define glDrawElements(m, c, t, i)                  swDrawElements((m), (c), (t), (i))
 #define glGenTextures(c, v)                         swGenTextures((c), (v))
 #define glDeleteTextures(c, v)                      swDeleteTextures((c), (v))
-#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2D((w), (h), (f), (t), SW_GL_BINDING_COPY_TEXTURE, (p))
+#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2DLevel((l), (w), (h), (f), (t), SW_GL_BINDING_COPY_TEXTURE, (p))
+#define glGenerateMipmap(tr)                        swGenerateMipmap()
 #define glTexParameteri(tr, pname, param)           swTexParameteri((pname), (param))
 #define glBindTexture(tr, id)                       swBindTexture((id))
+#define glGenFramebuffers(c, v)                     swGenFramebuffers((c), (v))
+#define glDeleteFramebuffers(c, v)                  swDeleteFramebuffers((c), (v))
+#define glBindFramebuffer(t, id)                    swBindFramebuffer((id))
+#define glFramebufferTexture2D(t, a, tt, id, l)     swFramebufferTexture2D((a), (id))
+#define glCheckFramebufferStatus(t)                 swCheckFramebufferStatus()
+#define glGetFramebufferAttachmentParameteriv(t, a, pname, params) swGetFramebufferAttachmentParameteriv((a), (pname), (params))
+#define glPixelStorei(pname, param)                 swPixelStorei((pname), (param))
+#define glFinish()                                  swFinish()
 
 // OpenGL functions NOT IMPLEMENTED by rlsw
 #define glClearDepth(X)                         ((void)(X))
 #define glDepthMask(X)                          ((void)(X))
 #define glColorMask(X,Y,Z,W)                    ((void)(X),(void)(Y),(void)(Z),(void)(W))
-#define glPixelStorei(X,Y)                      ((void)(X),(void)(Y))
 #define glHint(X,Y)                             ((void)(X),(void)(Y))
 #define glShadeModel(X)                         ((void)(X))
 #define glFrontFace(X)                          ((void)(X))
 #define glDepthFunc(X)                          ((void)(X))
 #define glTexSubImage2D(X,Y,Z,W,A,B,C,D,E)      ((void)(X),(void)(Y),(void)(Z),(void)(W),(void)(A),(void)(B),(void)(C),(void)(D),(void)(E))
 #define glGetTexImage(X,Y,Z,W,A)                ((void)(X),(void)(Y),(void)(Z),(void)(W),(void)(A))
-#define glDrawElements(X,Y,Z,W)                 ((void)(X),(void)(Y),(void)(Z),(void)(W))
 #define glNormal3f(X,Y,Z)                       ((void)(X),(void)(Y),(void)(Z))
 #define glNormal3fv(X)                          ((void)(X))
 #define glNormalPointer(X,Y,Z)                  ((void)(X),(void)(Y),(void)(Z))
@@ -404,7 +576,9 @@ typedef enum {
     SW_TEXTURE_2D = GL_TEXTURE_2D,
     SW_DEPTH_TEST = GL_DEPTH_TEST,
     SW_CULL_FACE = GL_CULL_FACE,
-    SW_BLEND = GL_BLEND
+    SW_BLEND = GL_BLEND,
+    SW_MULTISAMPLE = GL_MULTISAMPLE, // rlsw specific: no multisampled buffers, edges are anti-aliased analytically
+    SW_PARTIAL_CLEAR = 0x10000      // rlsw specific: swClear() only clears the region modified since the last full clear
 } SWstate;
 
 typedef enum {
@@ -423,7 +597,8 @@ typedef enum {
     SW_PROJECTION_STACK_DEPTH = GL_PROJECTION_STACK_DEPTH,
     SW_TEXTURE_MATRIX = GL_TEXTURE_MATRIX,
     SW_TEXTURE_STACK_DEPTH = GL_TEXTURE_STACK_DEPTH,
-    SW_VIEWPORT = GL_VIEWPORT
+    SW_VIEWPORT = GL_VIEWPORT,
+    SW_FRAMEBUFFER_BINDING = GL_FRAMEBUFFER_BINDING
 } SWget;
 
 typedef enum {
@@ -480,6 +655,7 @@ typedef enum {
     SW_LUMINANCE_ALPHA = GL_LUMINANCE_ALPHA,
     SW_RGB = GL_RGB,
     SW_RGBA = GL_RGBA,
+    SW_DEPTH_COMPONENT = GL_DEPTH_COMPONENT
 } SWformat;
 
 typedef enum {
@@ -489,12 +665,19 @@ typedef enum {
     SW_SHORT = GL_SHORT,
     SW_UNSIGNED_INT = GL_UNSIGNED_INT,
     SW_INT = GL_INT,
-    SW_FLOAT = GL_FLOAT
+    SW_FLOAT = GL_FLOAT,
+    SW_UNSIGNED_SHORT_5_6_5 = GL_UNSIGNED_SHORT_5_6_5,
+    SW_UNSIGNED_SHORT_5_5_5_1 = GL_UNSIGNED_SHORT_5_5_5_1,
+    SW_UNSIGNED_SHORT_4_4_4_4 = GL_UNSIGNED_SHORT_4_4_4_4
 } SWtype;
 
 typedef enum {
     SW_NEAREST = GL_NEAREST,
-    SW_LINEAR = GL_LINEAR
+    SW_LINEAR = GL_LINEAR,
+    SW_NEAREST_MIPMAP_NEAREST = GL_NEAREST_MIPMAP_NEAREST,
+    SW_LINEAR_MIPMAP_NEAREST = GL_LINEAR_MIPMAP_NEAREST,
+    SW_NEAREST_MIPMAP_LINEAR = GL_NEAREST_MIPMAP_LINEAR,
+    SW_LINEAR_MIPMAP_LINEAR = GL_LINEAR_MIPMAP_LINEAR
 } SWfilter;
 
 typedef enum {
@@ -509,6 +692,29 @@ typedef enum {
     SW_TEXTURE_WRAP_T = GL_TEXTURE_WRAP_T
 } SWtexparam;
 
+typedef enum {
+    SW_PACK_ROW_LENGTH = GL_PACK_ROW_LENGTH,
+    SW_PACK_ALIGNMENT = GL_PACK_ALIGNMENT,
+    SW_UNPACK_ALIGNMENT = GL_UNPACK_ALIGNMENT
+} SWpixelstore;
+
+typedef enum {
+    SW_COLOR_ATTACHMENT = GL_COLOR_ATTACHMENT0,
+    SW_DEPTH_ATTACHMENT = GL_DEPTH_ATTACHMENT
+} SWattachment;
+
+typedef enum {
+    SW_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE = GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE,
+    SW_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME = GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME
+} SWattachget;
+
+typedef enum {
+    SW_FRAMEBUFFER_COMPLETE = GL_FRAMEBUFFER_COMPLETE,
+    SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT = GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT,
+    SW_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT = GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT,
+    SW_FRAMEBUFFER_UNSUPPORTED = GL_FRAMEBUFFER_UNSUPPORTED
+} SWfbstatus;
+
 typedef enum {
     SW_NO_ERROR = GL_NO_ERROR,
     SW_INVALID_ENUM = GL_INVALID_ENUM,
@@ -518,23 +724,62 @@ typedef enum {
     SW_INVALID_OPERATION = GL_INVALID_OPERATION,
 } SWerrcode;
 
+// Rendering statistics, accumulated until swResetStats() (requires SW_ENABLE_STATS)
+// NOTE: With binning, deferred clears are rasterized (and timed) along with the primitives
+typedef struct {
+    uint32_t primitivesSubmitted;    // Primitives (points, lines, triangles, quads) rendered
+    uint32_t primitivesClipped;      // Primitives discarded by clipping
+    uint32_t primitivesCulled;       // Primitives discarded by face culling
+    uint32_t fragmentsShaded;        // Fragments that passed the depth test and were written
+    uint32_t fragmentsDepthRejected; // Fragments discarded by the depth test
+    uint32_t fragmentsBlended;       // Fragments blended with the color buffer
+    uint32_t texelsFetched;          // Texels read while sampling textures
+    double clearTime;                // Time spent clearing the framebuffer (seconds)
+    double rasterTime;               // Time spent processing and rasterizing primitives (seconds)
+    double copyTime;                 // Time spent copying/blitting the framebuffer (seconds)
+} SWstats;
+
+// Rendering context: framebuffer, textures, matrices and the rest of the renderer state
+// NOTE: Only the default context (swInit()) is available without SW_ENABLE_CONTEXTS
+typedef struct SWcontext SWcontext;
+
+// Called once a presented region has been written to its destination
+// NOTE: With SW_ENABLE_ASYNC_PRESENT, it is called from the present thread
+typedef void (*SWpresentcallback)(void *userData);
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Public API
 //------------------------------------------------------------------------------------
 SWAPI bool swInit(int w, int h);
 SWAPI void swClose(void);
 
+SWAPI SWcontext *swCreateContext(int w, int h, SWcontext *shareContext);
+SWAPI void swDestroyContext(SWcontext *context);
+SWAPI bool swMakeCurrent(SWcontext *context);
+SWAPI SWcontext *swGetCurrentContext(void);
+
 SWAPI bool swResizeFramebuffer(int w, int h);
 SWAPI void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels);
 SWAPI void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels);
+SWAPI void swPresentFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels, SWpresentcallback callback, void *userData);
+SWAPI void swWaitPresent(void);
 SWAPI void *swGetColorBuffer(int *w, int *h);
+SWAPI bool swSetColorBuffer(void *pixels);
+SWAPI bool swGetDirtyRect(int *x, int *y, int *w, int *h);
+SWAPI void swResetDirtyRect(void);
+SWAPI void swFinish(void);
 
 SWAPI void swEnable(SWstate state);
 SWAPI void swDisable(SWstate state);
 
+SWAPI void swPixelStorei(SWpixelstore pname, int param);
+
+SWAPI void swGetIntegerv(SWget name, int *v);
 SWAPI void swGetFloatv(SWget name, float *v);
 SWAPI const char *swGetString(SWget name);
 SWAPI SWerrcode swGetError(void);
+SWAPI void swGetStats(SWstats *stats);
+SWAPI void swResetStats(void);
 
 SWAPI void swViewport(int x, int y, int width, int height);
 SWAPI void swScissor(int x, int y, int width, int height);
@@ -587,14 +832,24 @@ SWAPI void swTexCoord2fv(const float *v);
 
 SWAPI void swBindArray(SWarray type, void *buffer);
 SWAPI void swDrawArrays(SWdraw mode, int offset, int count);
+SWAPI void swDrawElements(SWdraw mode, int count, SWtype type, const void *indices);
 
 SWAPI void swGenTextures(int count, uint32_t *textures);
 SWAPI void swDeleteTextures(int count, uint32_t *textures);
 
 SWAPI void swTexImage2D(int width, int height, SWformat format, SWtype type, bool copy, const void *data);
+SWAPI void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, bool copy, const void *data);
+SWAPI void swGenerateMipmap(void);
 SWAPI void swTexParameteri(int param, int value);
 SWAPI void swBindTexture(uint32_t id);
 
+SWAPI void swGenFramebuffers(int count, uint32_t *framebuffers);
+SWAPI void swDeleteFramebuffers(int count, uint32_t *framebuffers);
+SWAPI void swBindFramebuffer(uint32_t id);
+SWAPI void swFramebufferTexture2D(SWattachment attachment, uint32_t texture);
+SWAPI SWfbstatus swCheckFramebufferStatus(void);
+SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWattachget pname, int *params);
+
 #endif // RLSW_H
 
 /***********************************************************************************
@@ -608,6 +863,42 @@ SWAPI void swBindTexture(uint32_t id);
 #include <stdlib.h>
 #include <stddef.h>
 #include <math.h>           // Required for: floorf(), fabsf()
+#include <string.h>         // Required for: memcpy()
+
+#if SW_ENABLE_STATS
+    #include <time.h>       // Required for: clock_gettime(), timespec_get(), clock()
+#endif
+
+#if SW_ENABLE_SIMD
+    #if defined(__AVX2__)
+        #include <immintrin.h>  // Required for: AVX2 intrinsics
+        #define SW_SIMD_AVX2
+        #define SW_SIMD_WIDTH   8
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+        #define SW_SIMD_SSE2
+        #define SW_SIMD_WIDTH   4
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+        #define SW_SIMD_NEON
+        #define SW_SIMD_WIDTH   4
+    #endif
+#endif
+
+#ifndef SW_SIMD_WIDTH
+    #define SW_SIMD_WIDTH       1   // Scalar rasterization
+#endif
+
+#if SW_ENABLE_BINNING || SW_ENABLE_ASYNC_PRESENT || SW_ENABLE_CONTEXTS
+    #if defined(_MSC_VER)
+        #include <threads.h>    // Required for: thrd_create(), mtx_lock(), cnd_wait()
+        #define SW_THREAD_LOCAL __declspec(thread)
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()
+        #include <unistd.h>     // Required for: sysconf()
+        #define SW_THREAD_LOCAL __thread
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -619,6 +910,15 @@ SWAPI void swBindTexture(uint32_t id);
 #define SW_COLOR_PIXEL_SIZE     (SW_COLOR_BUFFER_BITS/8)
 #define SW_DEPTH_PIXEL_SIZE     (SW_DEPTH_BUFFER_BITS/8)
 
+// Red and blue bytes of the 32-bit color buffer pixels
+#if SW_COLOR_BUFFER_BGRA
+    #define SW_COLOR_OFFSET_R   2
+    #define SW_COLOR_OFFSET_B   0
+#else
+    #define SW_COLOR_OFFSET_R   0
+    #define SW_COLOR_OFFSET_B   2
+#endif
+
 #define SW_STATE_CHECK(flags)   ((RLSW.stateFlags & (flags)) == (flags))
 
 #define SW_STATE_SCISSOR_TEST   (1 << 0)
@@ -626,6 +926,18 @@ SWAPI void swBindTexture(uint32_t id);
 #define SW_STATE_DEPTH_TEST     (1 << 2)
 #define SW_STATE_CULL_FACE      (1 << 3)
 #define SW_STATE_BLEND          (1 << 4)
+#define SW_STATE_PARTIAL_CLEAR  (1 << 5)
+#define SW_STATE_MULTISAMPLE    (1 << 6)
+
+#if SW_ENABLE_STATS
+    #define SW_STATS_ADD(counter, n)        (RLSW.stats.counter += (uint32_t)(n))
+    #define SW_STATS_TIMER_BEGIN()          double statsTimerStart = sw_stats_timer_begin()
+    #define SW_STATS_TIMER_END(counter)     sw_stats_timer_end(&RLSW.stats.counter, statsTimerStart)
+#else
+    #define SW_STATS_ADD(counter, n)        ((void)0)
+    #define SW_STATS_TIMER_BEGIN()          ((void)0)
+    #define SW_STATS_TIMER_END(counter)     ((void)0)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
@@ -647,8 +959,26 @@ typedef enum {
     SW_PIXELFORMAT_UNCOMPRESSED_R16,               // 16 bpp (1 channel - half float)
     SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16,         // 16*3 bpp (3 channels - half float)
     SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16,      // 16*4 bpp (4 channels - half float)
+
+    // Internal formats, only used by render targets
+    SW_PIXELFORMAT_UNCOMPRESSED_R3G3B2,            // 8 bpp (color buffer layout with SW_COLOR_BUFFER_BITS == 8)
+    SW_PIXELFORMAT_UNCOMPRESSED_B8G8R8A8,          // 32 bpp (color buffer layout with SW_COLOR_BUFFER_BITS == 32 and SW_COLOR_BUFFER_BGRA)
+    SW_PIXELFORMAT_DEPTH,                          // SW_DEPTH_BUFFER_BITS bpp (depth buffer layout, unorm)
 } sw_pixelformat_t;
 
+// Texture format matching the color buffer layout, used by color attachments
+#if (SW_COLOR_BUFFER_BITS == 8)
+    #define SW_FRAMEBUFFER_COLOR_FORMAT     SW_PIXELFORMAT_UNCOMPRESSED_R3G3B2
+#elif (SW_COLOR_BUFFER_BITS == 16)
+    #define SW_FRAMEBUFFER_COLOR_FORMAT     SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5
+#elif (SW_COLOR_BUFFER_BITS == 24)
+    #define SW_FRAMEBUFFER_COLOR_FORMAT     SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8
+#elif (SW_COLOR_BUFFER_BITS == 32) && SW_COLOR_BUFFER_BGRA
+    #define SW_FRAMEBUFFER_COLOR_FORMAT     SW_PIXELFORMAT_UNCOMPRESSED_B8G8R8A8
+#elif (SW_COLOR_BUFFER_BITS == 32)
+    #define SW_FRAMEBUFFER_COLOR_FORMAT     SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+#endif
+
 typedef void (*sw_factor_f)(
     float *SW_RESTRICT factor,
     const float *SW_RESTRICT src,
@@ -667,7 +997,7 @@ typedef struct {
     float screen[2];            // Screen coordinates
 } sw_vertex_t;
 
-typedef struct {
+typedef struct sw_texture {
     // Dirty hack for copied data  
     // TODO: Rework copied image handling
     union {
@@ -677,8 +1007,12 @@ typedef struct {
 
     int width, height;          // Dimensions of the texture
     int wMinus1, hMinus1;       // Dimensions minus one
+    bool isPOT;                 // Flag indicating power of two dimensions (minus one dimensions used as wrap masks)
     sw_pixelformat_t format;    // Pixel format (internal representation)
 
+    bool tiled;                 // Flag indicating pixels are stored in 4x4 texel blocks (SW_TEXTURE_TILED)
+    int tileStride;             // Number of blocks per row of blocks
+
     SWfilter minFilter;         // Minification filter
     SWfilter magFilter;         // Magnification filter
 
@@ -690,18 +1024,133 @@ typedef struct {
 
     bool copy;                  // Flag indicating whether memory has been allocated
 
+    struct sw_texture *mipmaps; // Mipmap levels following the base level (level i stored at index i - 1)
+    int mipmapCount;            // Number of defined levels, base level included
+
+#if SW_ENABLE_CONTEXTS
+    SWcontext *fboContext;      // Context of the framebuffer objects the texture is attached to, NULL if none
+    int fboAttachments;         // Number of attachments to framebuffer objects of that context
+#endif
+
 } sw_texture_t;
 
+// Coarse depth of a framebuffer tile
+typedef struct {
+    float zMax;                     // Upper bound of the depth values stored in the tile
+    bool dirty;                     // Depth written since zMax was computed, the bound may be loose
+} sw_hiz_tile_t;
+
 typedef struct {
     void *color;
     void *depth;
+    sw_hiz_tile_t *hiz;             // Hierarchical depth tiles (SW_HIZ_TILE_SIZE pixels wide)
+    int hizWidth;                   // Number of hierarchical depth tiles per row
     int width;
     int height;
     int allocSz;
+    int hizAllocSz;
+    bool bottomUp;                  // Rows stored from the bottom, as textures (render targets)
+    bool externalColor;             // Color buffer memory provided with swSetColorBuffer(), not owned
+
+    int dirtyRect[4];               // Region modified since the last swResetDirtyRect(): xMin, yMin, xMax, yMax (exclusive)
+    int usedRect[4];                // Region modified since the last full clear, the rest still holds the cleared values
+    uint32_t clearedMask;           // Buffers of the last full clear, 0 if their content is unknown
+    float clearedColor[4];          // Values of the last full clear, partial clears are only valid if they match
+    float clearedDepth;
 } sw_framebuffer_t;
 
+// Framebuffer object, rendering into textures
+typedef struct {
+    uint32_t colorTexture;          // Texture attached as color buffer, stored in the color buffer layout
+    uint32_t depthTexture;          // Texture attached as depth buffer, 0: internal depth buffer
+    void *depth;                    // Internal depth buffer, used when no depth texture is attached
+    int depthAllocSz;
+    sw_hiz_tile_t *hiz;             // Hierarchical depth tiles of the render target
+    int hizAllocSz;
+    bool generated;                 // Flag indicating the id is in use
+} sw_fbo_t;
+
+// Polygon edge anti-aliased once the framebuffer is read, endpoints sorted so both windings match
+typedef struct {
+    float x0, y0, z0;               // First endpoint, screen space position and depth
+    float x1, y1, z1;               // Second endpoint
+    int next;                       // Next edge of the same hash bucket, -1 for the last one
+    int bucket;                     // Hash bucket of the edge
+    bool interior;                  // Shared by two polygons recorded in the same pass, left aliased
+} sw_edge_t;
+
+// Span interpolation data, shared by triangle scanlines and axis-aligned quad rows
+// NOTE: Values are given at the span origin, the pixel where the unclipped span starts,
+// every pixel evaluates them at its own distance from it, so clipping does not change them
+typedef struct {
+    const sw_texture_t *tex;        // Sampled texture
+    float z, w;                     // Depth and w reciprocal at the span origin
+    float color[4];                 // Color at the span origin
+    float u, v;                     // Texture coordinates at the span origin
+    float dzDx, dwDx;               // Depth and w reciprocal steps
+    float dcDx[4];                  // Color steps
+    float duDx, dvDx;               // Texture coordinates steps
+    float duDy, dvDy, dwDy;         // Texture coordinates and w reciprocal vertical derivatives
+    int offset;                     // First pixel of the span, in pixels from the span origin
+} sw_span_t;
+
+// Span rasterization function, 'count' pixels starting at 'cptr' and 'dptr'
+typedef void (*sw_span_f)(void *cptr, void *dptr, int count, const sw_span_t *span);
+
+// Blending done by the span functions, specialized modes do not go through the factor functions
+typedef enum {
+    SW_BLEND_MODE_NONE = 0,         // Blending disabled
+    SW_BLEND_MODE_GENERIC,          // Any blend factors
+    SW_BLEND_MODE_ALPHA,            // SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA
+    SW_BLEND_MODE_ADDITIVE,         // SW_SRC_ALPHA, SW_ONE
+    SW_BLEND_MODE_ALPHA_PREMULTIPLY // SW_ONE, SW_ONE_MINUS_SRC_ALPHA
+} sw_blend_mode_t;
+
+// Span functions selected for the current state, specialized when possible
+typedef struct {
+    uint32_t stateFlags;            // Texture, depth test and blend flags the spans were selected for
+    SWfactor srcFactor;             // Blend factors the spans were selected for
+    SWfactor dstFactor;
+    sw_pixelformat_t texFormat;     // Bound texture format the spans were selected for
+    sw_span_f triangleSpan;         // Span of triangles (perspective-correct), NULL until selected
+    sw_span_f quadSpan;             // Span of axis-aligned quads
+} sw_pipeline_t;
+
+// Mipmap level(s) and filter selected to sample a texture
+typedef struct {
+    const sw_texture_t *level;      // Sampled level
+    const sw_texture_t *nextLevel;  // Coarser level blended with trilinear filtering, NULL otherwise
+    float blend;                    // Weight of the coarser level
+    SWfilter filter;                // Filter applied within the level(s), SW_NEAREST or SW_LINEAR
+} sw_texture_lod_t;
+
+#if SW_ENABLE_BINNING || SW_ENABLE_ASYNC_PRESENT || SW_ENABLE_CONTEXTS
+#if defined(_MSC_VER)
+typedef thrd_t sw_thread_t;
+typedef mtx_t sw_mutex_t;
+typedef cnd_t sw_cond_t;
+#else
+typedef pthread_t sw_thread_t;
+typedef pthread_mutex_t sw_mutex_t;
+typedef pthread_cond_t sw_cond_t;
+#endif
+#endif
+
+// Texture objects, shared by the contexts created with the same share context
+typedef struct {
+    sw_texture_t *textures;         // Texture objects, indexed by id (SW_MAX_TEXTURES, never reallocated)
+    int textureCount;               // Number of ids used so far, including deleted ones
+    uint32_t *freeIds;              // Ids of deleted textures, reused first
+    int freeIdCount;
+    int refCount;                   // Number of contexts using the texture objects
+#if SW_ENABLE_CONTEXTS
+    sw_mutex_t mutex;               // Texture objects generation and deletion lock
+#endif
+} sw_texture_pool_t;
+
 typedef struct {
-    sw_framebuffer_t framebuffer;   // Main framebuffer
+    sw_framebuffer_t framebuffer;   // Bound framebuffer, main framebuffer or framebuffer object
+    sw_framebuffer_t mainFramebuffer; // Main framebuffer, kept aside while a framebuffer object is bound
     float clearColor[4];            // Color used to clear the screen
     float clearDepth;               // Depth value used to clear the screen
 
@@ -716,6 +1165,9 @@ typedef struct {
     float scClipMin[2];             // Scissor rectangle minimum renderable point in clip space
     float scClipMax[2];             // Scissor rectangle maximum renderable point in clip space
 
+    int rasterMin[2];               // Rasterization bounds minimum point (inclusive), framebuffer or current tile
+    int rasterMax[2];               // Rasterization bounds maximum point (exclusive), framebuffer or current tile
+
     uint32_t currentTexture;        // Current active texture id
 
     struct {
@@ -729,6 +1181,20 @@ typedef struct {
         float color[4];
     } current;
 
+    struct {
+        float *data;                // Single allocation holding the arrays below
+        float *x, *y, *z, *w;       // Homogeneous coordinates
+        float *u, *v;               // Texture coordinates, texture matrix applied
+        float *r, *g, *b, *a;       // Colors
+        int capacity;               // Number of vertices the arrays can hold
+    } vertexCache;                  // Post-transform vertex cache used by vertex array draws (SoA)
+
+    struct {
+        sw_edge_t *data;            // Edges of the polygons rasterized since the last pass (SW_MAX_AA_EDGES)
+        int *buckets;               // Hash buckets of the edges (2*SW_MAX_AA_EDGES), -1 if empty
+        int count;
+    } edges;                        // Polygon edges anti-aliased with SW_MULTISAMPLE, allocated on first use
+
     sw_vertex_t vertexBuffer[SW_MAX_CLIPPED_POLYGON_VERTICES];  // Buffer used for storing primitive vertices, used for processing and rendering
     int vertexCounter;                                          // Number of vertices in 'ctx.vertexBuffer'
 
@@ -755,23 +1221,185 @@ typedef struct {
     sw_factor_f srcFactorFunc;
     sw_factor_f dstFactorFunc;
 
+    sw_pipeline_t pipeline;                                     // Span functions selected for the current state
+
     SWface cullFace;                                            // Faces to cull
     SWerrcode errCode;                                          // Last error code
 
-    sw_texture_t *loadedTextures;
-    int loadedTextureCount;
+    sw_texture_t *loadedTextures;   // Texture objects of the texture pool
+    sw_texture_pool_t *texturePool;
 
-    uint32_t *freeTextureIds;
-    int freeTextureIdCount;
+    sw_fbo_t *loadedFramebuffers;
+    int loadedFramebufferCount;
+    uint32_t currentFramebuffer;    // Bound framebuffer object id, 0 for the main framebuffer
+
+    uint32_t *freeFramebufferIds;
+    int freeFramebufferIdCount;
+
+    int packRowLength;              // Destination row length of swCopyFramebuffer(), in pixels, 0 for tightly packed rows
 
     uint32_t stateFlags;
 
+#if SW_ENABLE_STATS
+    SWstats stats;                  // Rendering statistics, worker contexts are merged on flush
+    int statsTimerDepth;            // Nested timers are not accumulated, only the outermost one
+#endif
+
+#if SW_ENABLE_CONTEXTS
+    SWcontext *owner;               // Context object holding this state, also set on binning worker copies
+#endif
+
 } sw_context_t;
 
+#if SW_ENABLE_BINNING
+
+typedef enum {
+    SW_BIN_CMD_CLEAR = 0,           // Framebuffer clear, restricted to the tile
+    SW_BIN_CMD_POLYGON,             // Clipped convex polygon, rasterized as a triangle fan
+    SW_BIN_CMD_QUAD,                // Clipped axis-aligned quad
+    SW_BIN_CMD_LINE,                // Clipped line
+    SW_BIN_CMD_POINT                // Clipped point
+} sw_bin_cmd_type_t;
+
+// Rasterization state captured when recording commands
+typedef struct {
+    uint32_t stateFlags;
+    uint32_t currentTexture;
+    SWfactor srcFactor;
+    SWfactor dstFactor;
+    sw_factor_f srcFactorFunc;
+    sw_factor_f dstFactorFunc;
+    float pointRadius;
+    float lineWidth;
+    int vpCenter[2];
+    int vpHalfSize[2];
+    int vpMin[2];
+    int vpMax[2];
+    int scMin[2];
+    int scMax[2];
+    float clearColor[4];
+    float clearDepth;
+} sw_bin_state_t;
+
+typedef struct {
+    sw_bin_cmd_type_t type;         // Command type
+    int stateIndex;                 // Index of the rasterization state in the state list
+    int firstVertex;                // Index of the first screen-space vertex in the vertex pool
+    int vertexCount;                // Number of vertices used by the command
+    uint32_t clearMask;             // Buffers to clear (SW_BIN_CMD_CLEAR only)
+} sw_bin_cmd_t;
+
+typedef struct {
+    uint32_t *commands;             // Indices of the commands touching the tile, in submission order
+    int count;
+    int capacity;
+} sw_bin_t;
+
+typedef struct sw_binner sw_binner_t;
+
+typedef struct {
+    sw_context_t context;           // Worker context, copied from the recording context on flush
+    sw_binner_t *binner;            // Binner the worker takes its tiles from
+    sw_thread_t thread;
+} sw_bin_worker_t;
+
+struct sw_binner {
+    sw_bin_worker_t *workers;       // Worker contexts, the first one is used by the flushing thread
+    int threadCount;                // Number of rasterizing threads, binning is disabled if lower than 2
+
+    sw_mutex_t mutex;
+    sw_cond_t startCond;            // Signaled when a new flush is available to workers
+    sw_cond_t doneCond;             // Signaled when the last worker finished its tiles
+    uint32_t generation;            // Flush counter, used by workers to detect new work
+    int pendingWorkers;             // Number of workers still processing the current flush
+    int nextTile;                   // Next tile to be processed
+    bool quit;
+
+    sw_bin_t *bins;                 // Tiles command lists
+    int tilesX;
+    int tilesY;
+
+    sw_bin_cmd_t *commands;
+    int commandCount;
+    int commandCapacity;
+
+    sw_bin_state_t *states;
+    int stateCount;
+    int stateCapacity;
+
+    sw_vertex_t *vertices;
+    int vertexCount;
+    int vertexCapacity;
+};
+#endif // SW_ENABLE_BINNING
+
+#if SW_ENABLE_ASYNC_PRESENT
+// Frame handed over to the present thread
+typedef struct {
+    sw_thread_t thread;
+    bool running;                   // Present thread started, presentation is synchronous otherwise
+
+    sw_mutex_t mutex;
+    sw_cond_t startCond;            // Signaled when a new frame is available to present
+    sw_cond_t doneCond;             // Signaled when the current frame has been presented
+    bool pending;                   // A frame is being presented
+    bool quit;
+
+    void *color;                    // Snapshot of the presented region, color buffer layout, rows tightly packed
+    int allocSz;
+
+    int width;
+    int height;
+    sw_pixelformat_t format;
+    int rowLength;
+    void *pixels;
+    SWpresentcallback callback;
+    void *userData;
+} sw_presenter_t;
+#endif // SW_ENABLE_ASYNC_PRESENT
+
+// Context object, the renderer state along with the threads working on it
+struct SWcontext {
+    sw_context_t state;
+#if SW_ENABLE_BINNING
+    sw_binner_t binner;
+#endif
+#if SW_ENABLE_ASYNC_PRESENT
+    sw_presenter_t presenter;
+#endif
+};
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static sw_context_t RLSW = { 0 };
+static SWcontext swDefaultContext = { 0 };      // Context initialized by swInit()
+
+#if SW_ENABLE_BINNING || SW_ENABLE_CONTEXTS
+// NOTE: Rasterization workers run on their own copy of the context,
+// RLSW always refers to the context used by the calling thread
+static SW_THREAD_LOCAL sw_context_t *swCurrentContext = &swDefaultContext.state;
+#define RLSW (*swCurrentContext)
+#else
+#define RLSW (swDefaultContext.state)
+#endif
+
+#if SW_ENABLE_CONTEXTS
+    #define RLSW_CONTEXT    (*RLSW.owner)
+#else
+    #define RLSW_CONTEXT    swDefaultContext
+#endif
+
+#define RLSW_BINNER         (RLSW_CONTEXT.binner)
+#define RLSW_PRESENTER      (RLSW_CONTEXT.presenter)
+
+// Texture objects ids are generated and deleted under lock, contexts sharing them may run on other threads
+#if SW_ENABLE_CONTEXTS
+    #define SW_TEXTURE_POOL_LOCK()      sw_mutex_lock(&RLSW.texturePool->mutex)
+    #define SW_TEXTURE_POOL_UNLOCK()    sw_mutex_unlock(&RLSW.texturePool->mutex)
+#else
+    #define SW_TEXTURE_POOL_LOCK()
+    #define SW_TEXTURE_POOL_UNLOCK()
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
@@ -850,6 +1478,111 @@ static inline int sw_clampi(int v, int min, int max)
     return v;
 }
 
+static inline int sw_floori(float x)
+{
+    int i = (int)x;
+    return (x < i)? i - 1 : i;
+}
+
+// Conversion to 32.32 fixed point, rounded to nearest
+static inline int64_t sw_fixed32(double x)
+{
+    return (int64_t)floor(x*4294967296.0 + 0.5);
+}
+
+// SIMD helper functions
+// NOTE: A vector holds one value for SW_SIMD_WIDTH consecutive pixels,
+// integer conversions truncate toward zero like C casts do
+#if defined(SW_SIMD_AVX2)
+typedef __m256 sw_simd_t;
+static inline sw_simd_t sw_simd_set1(float x) { return _mm256_set1_ps(x); }
+static inline sw_simd_t sw_simd_load(const float *p) { return _mm256_loadu_ps(p); }
+static inline void sw_simd_store(float *p, sw_simd_t a) { _mm256_storeu_ps(p, a); }
+static inline sw_simd_t sw_simd_add(sw_simd_t a, sw_simd_t b) { return _mm256_add_ps(a, b); }
+static inline sw_simd_t sw_simd_sub(sw_simd_t a, sw_simd_t b) { return _mm256_sub_ps(a, b); }
+static inline sw_simd_t sw_simd_mul(sw_simd_t a, sw_simd_t b) { return _mm256_mul_ps(a, b); }
+static inline sw_simd_t sw_simd_div(sw_simd_t a, sw_simd_t b) { return _mm256_div_ps(a, b); }
+static inline sw_simd_t sw_simd_min(sw_simd_t a, sw_simd_t b) { return _mm256_min_ps(a, b); }
+static inline sw_simd_t sw_simd_max(sw_simd_t a, sw_simd_t b) { return _mm256_max_ps(a, b); }
+static inline uint32_t sw_simd_mask_le(sw_simd_t a, sw_simd_t b) { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ)); }
+static inline sw_simd_t sw_simd_load_int(const int32_t *p) { return _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)p)); }
+static inline void sw_simd_store_int(int32_t *p, sw_simd_t a) { _mm256_storeu_si256((__m256i *)p, _mm256_cvttps_epi32(a)); }
+#elif defined(SW_SIMD_SSE2)
+typedef __m128 sw_simd_t;
+static inline sw_simd_t sw_simd_set1(float x) { return _mm_set1_ps(x); }
+static inline sw_simd_t sw_simd_load(const float *p) { return _mm_loadu_ps(p); }
+static inline void sw_simd_store(float *p, sw_simd_t a) { _mm_storeu_ps(p, a); }
+static inline sw_simd_t sw_simd_add(sw_simd_t a, sw_simd_t b) { return _mm_add_ps(a, b); }
+static inline sw_simd_t sw_simd_sub(sw_simd_t a, sw_simd_t b) { return _mm_sub_ps(a, b); }
+static inline sw_simd_t sw_simd_mul(sw_simd_t a, sw_simd_t b) { return _mm_mul_ps(a, b); }
+static inline sw_simd_t sw_simd_div(sw_simd_t a, sw_simd_t b) { return _mm_div_ps(a, b); }
+static inline sw_simd_t sw_simd_min(sw_simd_t a, sw_simd_t b) { return _mm_min_ps(a, b); }
+static inline sw_simd_t sw_simd_max(sw_simd_t a, sw_simd_t b) { return _mm_max_ps(a, b); }
+static inline uint32_t sw_simd_mask_le(sw_simd_t a, sw_simd_t b) { return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(a, b)); }
+static inline sw_simd_t sw_simd_load_int(const int32_t *p) { return _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)p)); }
+static inline void sw_simd_store_int(int32_t *p, sw_simd_t a) { _mm_storeu_si128((__m128i *)p, _mm_cvttps_epi32(a)); }
+#elif defined(SW_SIMD_NEON)
+typedef float32x4_t sw_simd_t;
+static inline sw_simd_t sw_simd_set1(float x) { return vdupq_n_f32(x); }
+static inline sw_simd_t sw_simd_load(const float *p) { return vld1q_f32(p); }
+static inline void sw_simd_store(float *p, sw_simd_t a) { vst1q_f32(p, a); }
+static inline sw_simd_t sw_simd_add(sw_simd_t a, sw_simd_t b) { return vaddq_f32(a, b); }
+static inline sw_simd_t sw_simd_sub(sw_simd_t a, sw_simd_t b) { return vsubq_f32(a, b); }
+static inline sw_simd_t sw_simd_mul(sw_simd_t a, sw_simd_t b) { return vmulq_f32(a, b); }
+static inline sw_simd_t sw_simd_min(sw_simd_t a, sw_simd_t b) { return vminq_f32(a, b); }
+static inline sw_simd_t sw_simd_max(sw_simd_t a, sw_simd_t b) { return vmaxq_f32(a, b); }
+static inline sw_simd_t sw_simd_load_int(const int32_t *p) { return vcvtq_f32_s32(vld1q_s32(p)); }
+static inline void sw_simd_store_int(int32_t *p, sw_simd_t a) { vst1q_s32(p, vcvtq_s32_f32(a)); }
+static inline sw_simd_t sw_simd_div(sw_simd_t a, sw_simd_t b)
+{
+#if defined(__aarch64__)
+    return vdivq_f32(a, b);
+#else
+    // Reciprocal estimate refined with two Newton-Raphson steps
+    float32x4_t r = vrecpeq_f32(b);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    return vmulq_f32(a, r);
+#endif
+}
+static inline uint32_t sw_simd_mask_le(sw_simd_t a, sw_simd_t b)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    uint32x4_t m = vandq_u32(vcleq_f32(a, b), vld1q_u32(bits));
+    uint32x2_t s = vadd_u32(vget_low_u32(m), vget_high_u32(m));
+    return vget_lane_u32(vpadd_u32(s, s), 0);
+}
+#else
+typedef float sw_simd_t;
+static inline sw_simd_t sw_simd_set1(float x) { return x; }
+static inline sw_simd_t sw_simd_load(const float *p) { return *p; }
+static inline void sw_simd_store(float *p, sw_simd_t a) { *p = a; }
+static inline sw_simd_t sw_simd_add(sw_simd_t a, sw_simd_t b) { return a + b; }
+static inline sw_simd_t sw_simd_sub(sw_simd_t a, sw_simd_t b) { return a - b; }
+static inline sw_simd_t sw_simd_mul(sw_simd_t a, sw_simd_t b) { return a*b; }
+static inline sw_simd_t sw_simd_div(sw_simd_t a, sw_simd_t b) { return a/b; }
+static inline sw_simd_t sw_simd_min(sw_simd_t a, sw_simd_t b) { return (a < b)? a : b; }
+static inline sw_simd_t sw_simd_max(sw_simd_t a, sw_simd_t b) { return (a > b)? a : b; }
+static inline uint32_t sw_simd_mask_le(sw_simd_t a, sw_simd_t b) { return (a <= b)? 1 : 0; }
+static inline sw_simd_t sw_simd_load_int(const int32_t *p) { return (float)*p; }
+static inline void sw_simd_store_int(int32_t *p, sw_simd_t a) { *p = (int32_t)a; }
+#endif
+
+// Get the per-lane values of a linear function: start + step*lane
+static inline sw_simd_t sw_simd_ramp(float start, float step)
+{
+    float lanes[SW_SIMD_WIDTH];
+    for (int i = 0; i < SW_SIMD_WIDTH; i++) lanes[i] = start + step*i;
+    return sw_simd_load(lanes);
+}
+
+// Get the values of a linear function at per-lane positions: start + step*position
+// NOTE: Same operations as the scalar rasterizers, so both get the same values
+static inline sw_simd_t sw_simd_linear(float start, float step, sw_simd_t position)
+{
+    return sw_simd_add(sw_simd_set1(start), sw_simd_mul(sw_simd_set1(step), position));
+}
+
 static inline void sw_lerp_vertex_PTCH(
     sw_vertex_t *SW_RESTRICT out,
     const sw_vertex_t *SW_RESTRICT a,
@@ -937,6 +1670,34 @@ static inline void sw_add_vertex_grad_PTCH(
     out->homogeneous[3] += gradients->homogeneous[3];
 }
 
+static inline void sw_add_vertex_grad_scaled_PTCH(
+    sw_vertex_t *SW_RESTRICT out,
+    const sw_vertex_t *SW_RESTRICT gradients,
+    float scale)
+{
+    // Add scaled gradients to Position
+    out->position[0] += gradients->position[0]*scale;
+    out->position[1] += gradients->position[1]*scale;
+    out->position[2] += gradients->position[2]*scale;
+    out->position[3] += gradients->position[3]*scale;
+
+    // Add scaled gradients to Texture coordinates
+    out->texcoord[0] += gradients->texcoord[0]*scale;
+    out->texcoord[1] += gradients->texcoord[1]*scale;
+
+    // Add scaled gradients to Color
+    out->color[0] += gradients->color[0]*scale;
+    out->color[1] += gradients->color[1]*scale;
+    out->color[2] += gradients->color[2]*scale;
+    out->color[3] += gradients->color[3]*scale;
+
+    // Add scaled gradients to Homogeneous coordinates
+    out->homogeneous[0] += gradients->homogeneous[0]*scale;
+    out->homogeneous[1] += gradients->homogeneous[1]*scale;
+    out->homogeneous[2] += gradients->homogeneous[2]*scale;
+    out->homogeneous[3] += gradients->homogeneous[3]*scale;
+}
+
 // Half floating point management functions
 static inline uint32_t sw_f16_to_f32_ui(uint16_t h)
 {
@@ -990,7 +1751,109 @@ static inline sw_half_t sw_f16_from_f32(float i)
     return sw_f16_from_f32_ui(v.i);
 }
 
+#if SW_ENABLE_STATS
+// Statistics functions
+
+static inline double sw_stats_get_time(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#elif defined(TIME_UTC)
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#else
+    return (double)clock()/CLOCKS_PER_SEC;
+#endif
+}
+
+static inline double sw_stats_timer_begin(void)
+{
+    RLSW.statsTimerDepth++;
+    return sw_stats_get_time();
+}
+
+static inline void sw_stats_timer_end(double *counter, double start)
+{
+    if (--RLSW.statsTimerDepth == 0) *counter += sw_stats_get_time() - start;
+}
+
+static inline int sw_stats_count_bits(uint32_t mask)
+{
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) count++;
+    return count;
+}
+#endif // SW_ENABLE_STATS
+
+// Dirty region tracking functions
+// NOTE: Regions are stored as xMin, yMin, xMax, yMax (exclusive), in framebuffer rows as stored in memory
+
+static inline void sw_rect_set_empty(int rect[4])
+{
+    rect[0] = rect[1] = INT32_MAX;
+    rect[2] = rect[3] = 0;
+}
+
+static inline void sw_rect_merge(int rect[4], int xMin, int yMin, int xMax, int yMax)
+{
+    if (xMin < rect[0]) rect[0] = xMin;
+    if (yMin < rect[1]) rect[1] = yMin;
+    if (xMax > rect[2]) rect[2] = xMax;
+    if (yMax > rect[3]) rect[3] = yMax;
+}
+
+// The framebuffer content is unknown, it has to be presented and cleared entirely
+static inline void sw_framebuffer_reset_tracking(void)
+{
+    int w = RLSW.framebuffer.width, h = RLSW.framebuffer.height;
+
+    sw_rect_set_empty(RLSW.framebuffer.dirtyRect);
+    sw_rect_set_empty(RLSW.framebuffer.usedRect);
+    sw_rect_merge(RLSW.framebuffer.dirtyRect, 0, 0, w, h);
+    sw_rect_merge(RLSW.framebuffer.usedRect, 0, 0, w, h);
+    RLSW.framebuffer.clearedMask = 0;
+}
+
+// Record the region [xMin, xMax[ x [yMin, yMax[ as modified
+static inline void sw_framebuffer_mark(int xMin, int yMin, int xMax, int yMax)
+{
+    if (xMin < 0) xMin = 0;
+    if (yMin < 0) yMin = 0;
+    if (xMax > RLSW.framebuffer.width) xMax = RLSW.framebuffer.width;
+    if (yMax > RLSW.framebuffer.height) yMax = RLSW.framebuffer.height;
+    if ((xMin >= xMax) || (yMin >= yMax)) return;
+
+    sw_rect_merge(RLSW.framebuffer.dirtyRect, xMin, yMin, xMax, yMax);
+    sw_rect_merge(RLSW.framebuffer.usedRect, xMin, yMin, xMax, yMax);
+}
+
 // Framebuffer management functions
+static inline bool sw_framebuffer_load_hiz(int w, int h)
+{
+    if (!SW_ENABLE_HIZ) return true;
+
+    int hizWidth = (w + SW_HIZ_TILE_SIZE - 1)/SW_HIZ_TILE_SIZE;
+    int hizSize = hizWidth*((h + SW_HIZ_TILE_SIZE - 1)/SW_HIZ_TILE_SIZE);
+
+    if (hizSize > RLSW.framebuffer.hizAllocSz)
+    {
+        sw_hiz_tile_t *newHiz = SW_REALLOC(RLSW.framebuffer.hiz, hizSize*sizeof(sw_hiz_tile_t));
+        if (newHiz == NULL) return false;
+
+        RLSW.framebuffer.hiz = newHiz;
+        RLSW.framebuffer.hizAllocSz = hizSize;
+    }
+
+    // The depth buffer content is unknown, every tile has to be recomputed
+    for (int i = 0; i < hizSize; i++) RLSW.framebuffer.hiz[i] = (sw_hiz_tile_t){ 1.0f, true };
+    RLSW.framebuffer.hizWidth = hizWidth;
+
+    return true;
+}
+
 static inline bool sw_framebuffer_load(int w, int h)
 {
     int size = w*h;
@@ -1001,10 +1864,18 @@ static inline bool sw_framebuffer_load(int w, int h)
     RLSW.framebuffer.depth = SW_MALLOC(SW_DEPTH_PIXEL_SIZE*size);
     if (RLSW.framebuffer.depth == NULL) return false;
 
+    if (!sw_framebuffer_load_hiz(w, h)) return false;
+
     RLSW.framebuffer.width = w;
     RLSW.framebuffer.height = h;
     RLSW.framebuffer.allocSz = size;
 
+    RLSW.rasterMin[0] = RLSW.rasterMin[1] = 0;
+    RLSW.rasterMax[0] = w;
+    RLSW.rasterMax[1] = h;
+
+    sw_framebuffer_reset_tracking();
+
     return true;
 }
 
@@ -1012,17 +1883,36 @@ static inline bool sw_framebuffer_resize(int w, int h)
 {
     int newSize = w*h;
 
+    if (!sw_framebuffer_load_hiz(w, h)) return false;
+
+    // External memory is sized for the previous dimensions, rendering goes back to an owned color buffer
+    if (RLSW.framebuffer.externalColor)
+    {
+        void *color = SW_MALLOC(SW_COLOR_PIXEL_SIZE*RLSW.framebuffer.allocSz);
+        if (color == NULL) return false;
+
+        RLSW.framebuffer.color = color;
+        RLSW.framebuffer.externalColor = false;
+    }
+
     if (newSize <= RLSW.framebuffer.allocSz)
     {
         RLSW.framebuffer.width = w;
         RLSW.framebuffer.height = h;
+
+        RLSW.rasterMin[0] = RLSW.rasterMin[1] = 0;
+        RLSW.rasterMax[0] = w;
+        RLSW.rasterMax[1] = h;
+
+        sw_framebuffer_reset_tracking();
+
         return true;
     }
 
-    void *newColor = SW_REALLOC(RLSW.framebuffer.color, newSize);
+    void *newColor = SW_REALLOC(RLSW.framebuffer.color, SW_COLOR_PIXEL_SIZE*newSize);
     if (newColor == NULL) return false;
 
-    void *newDepth = SW_REALLOC(RLSW.framebuffer.depth, newSize);
+    void *newDepth = SW_REALLOC(RLSW.framebuffer.depth, SW_DEPTH_PIXEL_SIZE*newSize);
     if (newDepth == NULL) return false;
 
     RLSW.framebuffer.color = newColor;
@@ -1032,6 +1922,12 @@ static inline bool sw_framebuffer_resize(int w, int h)
     RLSW.framebuffer.height = h;
     RLSW.framebuffer.allocSz = newSize;
 
+    RLSW.rasterMin[0] = RLSW.rasterMin[1] = 0;
+    RLSW.rasterMax[0] = w;
+    RLSW.rasterMax[1] = h;
+
+    sw_framebuffer_reset_tracking();
+
     return true;
 }
 
@@ -1237,6 +2133,67 @@ static inline void sw_framebuffer_fill_color(void *ptr, int size, const float co
     }
 }
 
+#elif (SW_COLOR_BUFFER_BITS == 32)      // RGBA - (8:8:8:8), stored BGRA with SW_COLOR_BUFFER_BGRA
+
+static inline void sw_framebuffer_read_color(float dst[4], const void *src)
+{
+    dst[0] = ((uint8_t *)src)[SW_COLOR_OFFSET_R]*(1.0f/255.0f);
+    dst[1] = ((uint8_t *)src)[1]*(1.0f/255.0f);
+    dst[2] = ((uint8_t *)src)[SW_COLOR_OFFSET_B]*(1.0f/255.0f);
+    dst[3] = ((uint8_t *)src)[3]*(1.0f/255.0f);
+}
+
+static inline void sw_framebuffer_read_color8(uint8_t dst[4], const void *src)
+{
+    dst[0] = ((uint8_t *)src)[SW_COLOR_OFFSET_R];
+    dst[1] = ((uint8_t *)src)[1];
+    dst[2] = ((uint8_t *)src)[SW_COLOR_OFFSET_B];
+    dst[3] = ((uint8_t *)src)[3];
+}
+
+static inline void sw_framebuffer_write_color(void *dst, const float color[4])
+{
+    ((uint8_t *)dst)[SW_COLOR_OFFSET_R] = (uint8_t)(color[0]*UINT8_MAX);
+    ((uint8_t *)dst)[1] = (uint8_t)(color[1]*UINT8_MAX);
+    ((uint8_t *)dst)[SW_COLOR_OFFSET_B] = (uint8_t)(color[2]*UINT8_MAX);
+    ((uint8_t *)dst)[3] = (uint8_t)(sw_saturate(color[3])*UINT8_MAX); // NOTE: Blending saturates RGB only
+}
+
+static inline uint32_t sw_framebuffer_pack_color(const float color[4])
+{
+    uint8_t pixel[4];
+    pixel[SW_COLOR_OFFSET_R] = (uint8_t)(color[0]*255.0f);
+    pixel[1] = (uint8_t)(color[1]*255.0f);
+    pixel[SW_COLOR_OFFSET_B] = (uint8_t)(color[2]*255.0f);
+    pixel[3] = (uint8_t)(color[3]*255.0f);
+
+    uint32_t packedColor;
+    memcpy(&packedColor, pixel, sizeof(uint32_t));
+
+    return packedColor;
+}
+
+static inline void sw_framebuffer_fill_color(void *ptr, int size, const float color[4])
+{
+    uint32_t packedColor = sw_framebuffer_pack_color(color);
+
+    uint32_t *p = (uint32_t *)ptr;
+
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        int wScissor = RLSW.scMax[0] - RLSW.scMin[0] + 1;
+        for (int y = RLSW.scMin[1]; y <= RLSW.scMax[1]; y++)
+        {
+            uint32_t *curPtr = p + y*RLSW.framebuffer.width + RLSW.scMin[0];
+            for (int xCount = 0; xCount < wScissor; xCount++) *curPtr++ = packedColor;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < size; i++) *p++ = packedColor;
+    }
+}
+
 #endif // SW_COLOR_BUFFER_BITS
 
 #if (SW_DEPTH_BUFFER_BITS == 8)
@@ -1359,7 +2316,271 @@ static inline void sw_framebuffer_fill_depth(void *ptr, int size, float value)
 
 #endif // SW_DEPTH_BUFFER_BITS
 
-static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size, float color[4], float depth_value)
+// Hierarchical depth functionality
+// NOTE: Each tile keeps an upper bound of its depth values, a primitive whose nearest depth
+// is farther than the bound of every tile it covers would fail the depth test on all of its
+// pixels. The bounds only get loose when depth is written (writes passing the depth test can
+// only bring depth closer), they are made exact again on demand by reading back the tile
+// Tiles never straddle two binning tiles, so worker threads never share a hierarchical tile
+
+#define SW_HIZ_EPSILON 1e-5f    // Margin covering the depth interpolation rounding errors
+
+static inline void sw_hiz_refresh(sw_hiz_tile_t *tile, int tx, int ty)
+{
+    int x0 = tx*SW_HIZ_TILE_SIZE, y0 = ty*SW_HIZ_TILE_SIZE;
+    int x1 = x0 + SW_HIZ_TILE_SIZE, y1 = y0 + SW_HIZ_TILE_SIZE;
+    if (x1 > RLSW.framebuffer.width) x1 = RLSW.framebuffer.width;
+    if (y1 > RLSW.framebuffer.height) y1 = RLSW.framebuffer.height;
+
+    float zMax = 0.0f;
+    for (int y = y0; y < y1; y++)
+    {
+        const void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + x0);
+        for (int x = x0; x < x1; x++)
+        {
+            float depth = sw_framebuffer_read_depth(dptr);
+            if (depth > zMax) zMax = depth;
+            dptr = sw_framebuffer_get_depth_addr(dptr, 1);
+        }
+    }
+
+    tile->zMax = zMax;
+    tile->dirty = false;
+}
+
+// Check if a primitive at depth 'zMin' or farther can pass the depth test within [xMin, xMax[ x [yMin, yMax[
+// NOTE: The bounds of dirty tiles are only recomputed when requested, reading a tile back
+// only pays off for primitives covering many pixels
+static inline bool sw_hiz_test(int xMin, int yMin, int xMax, int yMax, float zMin, bool refresh)
+{
+    if (!SW_ENABLE_HIZ) return true;
+
+    zMin -= SW_HIZ_EPSILON;
+
+    int tx0 = xMin/SW_HIZ_TILE_SIZE, tx1 = (xMax - 1)/SW_HIZ_TILE_SIZE;
+    int ty0 = yMin/SW_HIZ_TILE_SIZE, ty1 = (yMax - 1)/SW_HIZ_TILE_SIZE;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        sw_hiz_tile_t *tile = &RLSW.framebuffer.hiz[ty*RLSW.framebuffer.hizWidth + tx0];
+        for (int tx = tx0; tx <= tx1; tx++, tile++)
+        {
+            if (tile->zMax < zMin) continue;
+            if (!refresh || !tile->dirty) return true;
+
+            sw_hiz_refresh(tile, tx, ty);
+            if (tile->zMax >= zMin) return true;
+        }
+    }
+
+    return false;
+}
+
+// Record depth values within [zMin, zMax] written in [xMin, xMax[ x [yMin, yMax[
+static inline void sw_hiz_update(int xMin, int yMin, int xMax, int yMax, float zMin, float zMax, bool depthTest)
+{
+    if (!SW_ENABLE_HIZ) return;
+
+    // Without depth test the written values can be farther than the bound,
+    // out of range values are not clamped when quantized and may end up anywhere
+    float zRaise = -1.0f;
+    if ((zMin < 0.0f) || (zMax > 1.0f)) zRaise = 1.0f;
+    else if (!depthTest) zRaise = zMax + SW_HIZ_EPSILON;
+
+    int tx0 = xMin/SW_HIZ_TILE_SIZE, tx1 = (xMax - 1)/SW_HIZ_TILE_SIZE;
+    int ty0 = yMin/SW_HIZ_TILE_SIZE, ty1 = (yMax - 1)/SW_HIZ_TILE_SIZE;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        sw_hiz_tile_t *tile = &RLSW.framebuffer.hiz[ty*RLSW.framebuffer.hizWidth + tx0];
+        for (int tx = tx0; tx <= tx1; tx++, tile++)
+        {
+            if (tile->zMax < zRaise) tile->zMax = zRaise;
+            tile->dirty = true;
+        }
+    }
+}
+
+// Record a depth clear of the framebuffer, or of the scissor area when enabled
+static inline void sw_hiz_clear(void)
+{
+    if (!SW_ENABLE_HIZ) return;
+
+    int xMin = 0, yMin = 0;
+    int xMax = RLSW.framebuffer.width, yMax = RLSW.framebuffer.height;
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        xMin = RLSW.scMin[0], yMin = RLSW.scMin[1];
+        xMax = RLSW.scMax[0] + 1, yMax = RLSW.scMax[1] + 1;
+    }
+    if ((xMin >= xMax) || (yMin >= yMax)) return;
+
+    // Read the cleared value back, as quantized in the depth buffer
+    float depth = sw_framebuffer_read_depth(sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, yMin*RLSW.framebuffer.width + xMin));
+
+    int tx0 = xMin/SW_HIZ_TILE_SIZE, tx1 = (xMax - 1)/SW_HIZ_TILE_SIZE;
+    int ty0 = yMin/SW_HIZ_TILE_SIZE, ty1 = (yMax - 1)/SW_HIZ_TILE_SIZE;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        sw_hiz_tile_t *tile = &RLSW.framebuffer.hiz[ty*RLSW.framebuffer.hizWidth + tx0];
+        for (int tx = tx0; tx <= tx1; tx++, tile++)
+        {
+            // Tiles partially cleared keep their other depth values
+            bool covered = (tx*SW_HIZ_TILE_SIZE >= xMin) && (ty*SW_HIZ_TILE_SIZE >= yMin) &&
+                           (((tx + 1)*SW_HIZ_TILE_SIZE <= xMax) || (xMax == RLSW.framebuffer.width)) &&
+                           (((ty + 1)*SW_HIZ_TILE_SIZE <= yMax) || (yMax == RLSW.framebuffer.height));
+
+            if (covered) *tile = (sw_hiz_tile_t){ depth, false };
+            else
+            {
+                if (tile->zMax < depth) tile->zMax = depth;
+                tile->dirty = true;
+            }
+        }
+    }
+}
+
+// Vector framebuffer access, reads 'count' consecutive pixels and writes the pixels set in 'mask'
+// NOTE: Values are converted like the scalar functions above
+static inline void sw_framebuffer_read_color_simd(sw_simd_t dst[4], const void *src, int count)
+{
+    int32_t r[SW_SIMD_WIDTH] = { 0 }, g[SW_SIMD_WIDTH] = { 0 }, b[SW_SIMD_WIDTH] = { 0 };
+
+#if (SW_COLOR_BUFFER_BITS == 8)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++)
+    {
+        uint8_t pixel = ((const uint8_t *)src)[i];
+        r[i] = (pixel >> 5) & 0x07; g[i] = (pixel >> 2) & 0x07; b[i] = pixel & 0x03;
+    }
+    dst[0] = sw_simd_mul(sw_simd_load_int(r), sw_simd_set1(1.0f/7.0f));
+    dst[1] = sw_simd_mul(sw_simd_load_int(g), sw_simd_set1(1.0f/7.0f));
+    dst[2] = sw_simd_mul(sw_simd_load_int(b), sw_simd_set1(1.0f/3.0f));
+#elif (SW_COLOR_BUFFER_BITS == 16)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++)
+    {
+        uint16_t pixel = ((const uint16_t *)src)[i];
+        r[i] = (pixel >> 11) & 0x1F; g[i] = (pixel >> 5) & 0x3F; b[i] = pixel & 0x1F;
+    }
+    dst[0] = sw_simd_mul(sw_simd_load_int(r), sw_simd_set1(1.0f/31.0f));
+    dst[1] = sw_simd_mul(sw_simd_load_int(g), sw_simd_set1(1.0f/63.0f));
+    dst[2] = sw_simd_mul(sw_simd_load_int(b), sw_simd_set1(1.0f/31.0f));
+#elif (SW_COLOR_BUFFER_BITS == 24)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++)
+    {
+        const uint8_t *pixel = (const uint8_t *)src + 3*i;
+        r[i] = pixel[0]; g[i] = pixel[1]; b[i] = pixel[2];
+    }
+    dst[0] = sw_simd_mul(sw_simd_load_int(r), sw_simd_set1(1.0f/255.0f));
+    dst[1] = sw_simd_mul(sw_simd_load_int(g), sw_simd_set1(1.0f/255.0f));
+    dst[2] = sw_simd_mul(sw_simd_load_int(b), sw_simd_set1(1.0f/255.0f));
+#elif (SW_COLOR_BUFFER_BITS == 32)
+    int32_t a[SW_SIMD_WIDTH] = { 0 };
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++)
+    {
+        const uint8_t *pixel = (const uint8_t *)src + 4*i;
+        r[i] = pixel[SW_COLOR_OFFSET_R]; g[i] = pixel[1]; b[i] = pixel[SW_COLOR_OFFSET_B]; a[i] = pixel[3];
+    }
+    dst[0] = sw_simd_mul(sw_simd_load_int(r), sw_simd_set1(1.0f/255.0f));
+    dst[1] = sw_simd_mul(sw_simd_load_int(g), sw_simd_set1(1.0f/255.0f));
+    dst[2] = sw_simd_mul(sw_simd_load_int(b), sw_simd_set1(1.0f/255.0f));
+    dst[3] = sw_simd_mul(sw_simd_load_int(a), sw_simd_set1(1.0f/255.0f));
+#endif
+#if (SW_COLOR_BUFFER_BITS != 32)
+    dst[3] = sw_simd_set1(1.0f);
+#endif
+}
+
+static inline void sw_framebuffer_write_color_simd(void *dst, const sw_simd_t color[4], uint32_t mask)
+{
+    int32_t r[SW_SIMD_WIDTH], g[SW_SIMD_WIDTH], b[SW_SIMD_WIDTH];
+
+#if (SW_COLOR_BUFFER_BITS == 8)
+    sw_simd_store_int(r, sw_simd_mul(color[0], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(g, sw_simd_mul(color[1], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(b, sw_simd_mul(color[2], sw_simd_set1(UINT8_MAX)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++)
+    {
+        if (!(mask & (1u << i))) continue;
+        ((uint8_t *)dst)[i] = ((((uint8_t)r[i] >> 5) & 0x07) << 5) | ((((uint8_t)g[i] >> 5) & 0x07) << 2) | (((uint8_t)b[i] >> 6) & 0x03);
+    }
+#elif (SW_COLOR_BUFFER_BITS == 16)
+    const sw_simd_t half = sw_simd_set1(0.5f);
+    sw_simd_store_int(r, sw_simd_add(sw_simd_mul(color[0], sw_simd_set1(31.0f)), half));
+    sw_simd_store_int(g, sw_simd_add(sw_simd_mul(color[1], sw_simd_set1(63.0f)), half));
+    sw_simd_store_int(b, sw_simd_add(sw_simd_mul(color[2], sw_simd_set1(31.0f)), half));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++)
+    {
+        if (!(mask & (1u << i))) continue;
+        ((uint16_t *)dst)[i] = ((r[i] & 0x1F) << 11) | ((g[i] & 0x3F) << 5) | (b[i] & 0x1F);
+    }
+#elif (SW_COLOR_BUFFER_BITS == 24)
+    sw_simd_store_int(r, sw_simd_mul(color[0], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(g, sw_simd_mul(color[1], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(b, sw_simd_mul(color[2], sw_simd_set1(UINT8_MAX)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++)
+    {
+        if (!(mask & (1u << i))) continue;
+        uint8_t *pixel = (uint8_t *)dst + 3*i;
+        pixel[0] = (uint8_t)r[i]; pixel[1] = (uint8_t)g[i]; pixel[2] = (uint8_t)b[i];
+    }
+#elif (SW_COLOR_BUFFER_BITS == 32)
+    int32_t a[SW_SIMD_WIDTH];
+    sw_simd_store_int(r, sw_simd_mul(color[0], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(g, sw_simd_mul(color[1], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(b, sw_simd_mul(color[2], sw_simd_set1(UINT8_MAX)));
+    sw_simd_store_int(a, sw_simd_mul(sw_simd_min(sw_simd_max(color[3], sw_simd_set1(0.0f)), sw_simd_set1(1.0f)), sw_simd_set1(UINT8_MAX)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++)
+    {
+        if (!(mask & (1u << i))) continue;
+        uint8_t *pixel = (uint8_t *)dst + 4*i;
+        pixel[SW_COLOR_OFFSET_R] = (uint8_t)r[i]; pixel[1] = (uint8_t)g[i]; pixel[SW_COLOR_OFFSET_B] = (uint8_t)b[i]; pixel[3] = (uint8_t)a[i];
+    }
+#endif
+}
+
+static inline sw_simd_t sw_framebuffer_read_depth_simd(const void *src, int count)
+{
+    int32_t depth[SW_SIMD_WIDTH] = { 0 };
+
+#if (SW_DEPTH_BUFFER_BITS == 8)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++) depth[i] = ((const uint8_t *)src)[i];
+    return sw_simd_mul(sw_simd_load_int(depth), sw_simd_set1(1.0f/UINT8_MAX));
+#elif (SW_DEPTH_BUFFER_BITS == 16)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++) depth[i] = ((const uint16_t *)src)[i];
+    return sw_simd_mul(sw_simd_load_int(depth), sw_simd_set1(1.0f/UINT16_MAX));
+#elif (SW_DEPTH_BUFFER_BITS == 24)
+    for (int i = 0; (i < SW_SIMD_WIDTH) && (i < count); i++)
+    {
+        const uint8_t *pixel = (const uint8_t *)src + 3*i;
+        depth[i] = (pixel[0] << 16) | (pixel[1] << 8) | pixel[2];
+    }
+    return sw_simd_div(sw_simd_load_int(depth), sw_simd_set1((float)0xFFFFFF));
+#endif
+}
+
+static inline void sw_framebuffer_write_depth_simd(void *dst, sw_simd_t depth, uint32_t mask)
+{
+    int32_t value[SW_SIMD_WIDTH];
+
+#if (SW_DEPTH_BUFFER_BITS == 8)
+    sw_simd_store_int(value, sw_simd_mul(depth, sw_simd_set1(UINT8_MAX)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++) if (mask & (1u << i)) ((uint8_t *)dst)[i] = (uint8_t)value[i];
+#elif (SW_DEPTH_BUFFER_BITS == 16)
+    sw_simd_store_int(value, sw_simd_mul(depth, sw_simd_set1(UINT16_MAX)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++) if (mask & (1u << i)) ((uint16_t *)dst)[i] = (uint16_t)value[i];
+#elif (SW_DEPTH_BUFFER_BITS == 24)
+    sw_simd_store_int(value, sw_simd_mul(depth, sw_simd_set1((float)0xFFFFFF)));
+    for (int i = 0; i < SW_SIMD_WIDTH; i++)
+    {
+        if (!(mask & (1u << i))) continue;
+        uint8_t *pixel = (uint8_t *)dst + 3*i;
+        pixel[0] = (value[i] >> 16) & 0xFF; pixel[1] = (value[i] >> 8) & 0xFF; pixel[2] = value[i] & 0xFF;
+    }
+#endif
+}
+
+static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size, float color[4], float depth_value)
 {
 #if (SW_COLOR_BUFFER_BITS == 8)
     // Calculate and pack 3:3:2 color
@@ -1385,6 +2606,10 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
     uint8_t g24 = (uint8_t)(color[1]*255.0f);
     uint8_t b24 = (uint8_t)(color[2]*255.0f);
     uint8_t *cptr = (uint8_t *)colorPtr;
+#elif (SW_COLOR_BUFFER_BITS == 32)
+    // Pack 8:8:8:8 color in the color buffer byte order
+    uint32_t packedColor = sw_framebuffer_pack_color(color);
+    uint32_t *cptr = (uint32_t *)colorPtr;
 #endif
 
 #if (SW_DEPTH_BUFFER_BITS == 8)
@@ -1418,6 +2643,8 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
             uint16_t *curCPtr = cptr + rowStartIdx;
         #elif (SW_COLOR_BUFFER_BITS == 24)
             uint8_t *curCPtr = cptr + 3*rowStartIdx;
+        #elif (SW_COLOR_BUFFER_BITS == 32)
+            uint32_t *curCPtr = cptr + rowStartIdx;
         #endif
 
         #if (SW_DEPTH_BUFFER_BITS == 8)
@@ -1440,6 +2667,8 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
                 *curCPtr++ = r24;
                 *curCPtr++ = g24;
                 *curCPtr++ = b24;
+            #elif (SW_COLOR_BUFFER_BITS == 32)
+                *curCPtr++ = packedColor;
             #endif
 
                 // Write depth
@@ -1468,6 +2697,8 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
         *cptr++ = r24;
         *cptr++ = g24;
         *cptr++ = b24;
+    #elif (SW_COLOR_BUFFER_BITS == 32)
+        *cptr++ = packedColor;
     #endif
 
         // Write depth
@@ -1483,23 +2714,23 @@ static inline void sw_framebuffer_fill(void *colorPtr, void *depthPtr, int size,
     }
 }
 
-#define DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(name, DST_PTR_T)                      \
-static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst)   \
+#define DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(name, DST_PTR_T, DST_CHANNELS)        \
+static inline void sw_framebuffer_copy_to_##name(const void *color, int stride, int x, int y, int w, int h, int rowLength, DST_PTR_T *pixels) \
 {                                                                               \
-    const void *src = RLSW.framebuffer.color;                                   \
-                                                                                \
-    for (int iy = y; iy < h; iy++) {                                            \
-        for (int ix = x; ix < w; ix++) {                                        \
+    for (int iy = 0; iy < h; iy++) {                                            \
+        const void *src = sw_framebuffer_get_color_addr(color, (y + iy)*stride + x); \
+        DST_PTR_T *dst = pixels + iy*rowLength*(DST_CHANNELS);                  \
+        for (int ix = 0; ix < w; ix++) {                                        \
             uint8_t color[4];                                                   \
             sw_framebuffer_read_color8(color, src);                             \
 
-#define DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(name, DST_PTR_T)                      \
-static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst)   \
+#define DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(name, DST_PTR_T, DST_CHANNELS)        \
+static inline void sw_framebuffer_copy_to_##name(const void *color, int stride, int x, int y, int w, int h, int rowLength, DST_PTR_T *pixels) \
 {                                                                               \
-    const void *src = RLSW.framebuffer.color;                                   \
-                                                                                \
-    for (int iy = y; iy < h; iy++) {                                            \
-        for (int ix = x; ix < w; ix++) {                                        \
+    for (int iy = 0; iy < h; iy++) {                                            \
+        const void *src = sw_framebuffer_get_color_addr(color, (y + iy)*stride + x); \
+        DST_PTR_T *dst = pixels + iy*rowLength*(DST_CHANNELS);                  \
+        for (int ix = 0; ix < w; ix++) {                                        \
             float color[4];                                                     \
             sw_framebuffer_read_color(color, src);                              \
 
@@ -1509,7 +2740,7 @@ static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST
     }                                                                           \
 }
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYSCALE, uint8_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYSCALE, uint8_t, 1)
 {
     // NTSC grayscale conversion: Y = 0.299R + 0.587G + 0.114B
     uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
@@ -1517,7 +2748,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYSCALE, uint8_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYALPHA, uint8_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYALPHA, uint8_t, 2)
 {
     // Convert RGB to grayscale using NTSC formula
     uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
@@ -1529,7 +2760,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(GRAYALPHA, uint8_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G6B5, uint16_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G6B5, uint16_t, 1)
 {
     // Convert 8-bit RGB to 5:6:5 format
     uint8_t r5 = (color[0]*31 + 127)/255;
@@ -1546,7 +2777,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G6B5, uint16_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8, uint8_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8, uint8_t, 3)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = color[2];
@@ -1562,7 +2793,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8, uint8_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G5B5A1, uint16_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G5B5A1, uint16_t, 1)
 {
     uint8_t r5 = (color[0]*31 + 127)/255;
     uint8_t g5 = (color[1]*31 + 127)/255;
@@ -1579,7 +2810,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R5G5B5A1, uint16_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R4G4B4A4, uint16_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R4G4B4A4, uint16_t, 1)
 {
     uint8_t r4 = (color[0]*15 + 127)/255;
     uint8_t g4 = (color[1]*15 + 127)/255;
@@ -1596,7 +2827,7 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R4G4B4A4, uint16_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8A8, uint8_t)
+DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8A8, uint8_t, 4)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = color[2];
@@ -1613,14 +2844,14 @@ DEFINE_FRAMEBUFFER_COPY_U32_BEGIN(R8G8B8A8, uint8_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32, float)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32, float, 1)
 {
     dst[0] = color[0];
     dst++;
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32, float)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32, float, 3)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = color[2];
@@ -1636,7 +2867,7 @@ DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32, float)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32A32, float)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32A32, float, 4)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = color[2];
@@ -1653,14 +2884,14 @@ DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R32G32B32A32, float)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16, sw_half_t)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16, sw_half_t, 1)
 {
     dst[0] = sw_f16_from_f32(color[0]);
     dst++;
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16, sw_half_t)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16, sw_half_t, 3)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = sw_f16_from_f32(color[2]);
@@ -1676,7 +2907,7 @@ DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16, sw_half_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16A16, sw_half_t)
+DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16A16, sw_half_t, 4)
 {
 #if SW_GL_FRAMEBUFFER_COPY_BGRA
     dst[0] = sw_f16_from_f32(color[2]);
@@ -1693,6 +2924,44 @@ DEFINE_FRAMEBUFFER_COPY_F32_BEGIN(R16G16B16A16, sw_half_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
+// Convert a region of a color buffer laid out as the framebuffer, 'stride' pixels per row
+// NOTE: Returns false if the destination format is not supported
+static bool sw_framebuffer_copy_region(const void *color, int stride, int x, int y, int w, int h, sw_pixelformat_t format, int rowLength, void *pixels)
+{
+#if (SW_COLOR_BUFFER_BITS == 32) && (SW_COLOR_BUFFER_BGRA == SW_GL_FRAMEBUFFER_COPY_BGRA)
+    // Color buffer layout already matches the RGBA8 output, rows are copied as they are
+    if (format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        for (int iy = 0; iy < h; iy++)
+        {
+            memcpy((uint8_t *)pixels + 4*iy*rowLength, sw_framebuffer_get_color_addr(color, (y + iy)*stride + x), 4*w);
+        }
+
+        return true;
+    }
+#endif
+
+    switch (format)
+    {
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_copy_to_GRAYSCALE(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: sw_framebuffer_copy_to_GRAYALPHA(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5: sw_framebuffer_copy_to_R5G6B5(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32: sw_framebuffer_copy_to_R32(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32: sw_framebuffer_copy_to_R32G32B32(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: sw_framebuffer_copy_to_R32G32B32A32(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16: sw_framebuffer_copy_to_R16(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: sw_framebuffer_copy_to_R16G16B16(color, stride, x, y, w, h, rowLength, pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_framebuffer_copy_to_R16G16B16A16(color, stride, x, y, w, h, rowLength, pixels); break;
+        default: return false;
+    }
+
+    return true;
+}
+
 #define DEFINE_FRAMEBUFFER_BLIT_U32_BEGIN(name, DST_PTR_T)                      \
 static inline void sw_framebuffer_blit_to_##name(                               \
     int xDst, int yDst, int wDst, int hDst,                                     \
@@ -1932,6 +3201,18 @@ static inline int sw_get_pixel_format(SWformat format, SWtype type)
     int channels = 0;
     int bitsPerChannel = 8; // Default: 8 bits per channel
 
+    // Depth textures are stored in the depth buffer layout, whatever the type
+    if (format == SW_DEPTH_COMPONENT) return SW_PIXELFORMAT_DEPTH;
+
+    // Packed types define the layout of the whole pixel
+    switch (type)
+    {
+        case SW_UNSIGNED_SHORT_5_6_5: return (format == SW_RGB)? SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5 : SW_PIXELFORMAT_UNKNOWN;
+        case SW_UNSIGNED_SHORT_5_5_5_1: return (format == SW_RGBA)? SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1 : SW_PIXELFORMAT_UNKNOWN;
+        case SW_UNSIGNED_SHORT_4_4_4_4: return (format == SW_RGBA)? SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 : SW_PIXELFORMAT_UNKNOWN;
+        default: break;
+    }
+
     // Determine the number of channels (format)
     switch (format)
     {
@@ -1998,6 +3279,9 @@ int sw_get_pixel_bytes(sw_pixelformat_t format)
         case SW_PIXELFORMAT_UNCOMPRESSED_R16: bpp = 2; break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 2*3; break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 2*4; break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R3G3B2: bpp = 1; break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_B8G8R8A8: bpp = 4; break;
+        case SW_PIXELFORMAT_DEPTH: bpp = SW_DEPTH_PIXEL_SIZE; break;
         default: break;
     }
 
@@ -2132,6 +3416,36 @@ static inline void sw_get_pixel_rgba_32323232(float *color, const void *pixels,
     color[3] = pixel[3];
 }
 
+static inline void sw_get_pixel_rgb_332(float *color, const void *pixels, uint32_t offset)
+{
+    uint8_t pixel = ((uint8_t *)pixels)[offset];
+
+    color[0] = ((pixel >> 5) & 0x07)*(1.0f/7.0f);
+    color[1] = ((pixel >> 2) & 0x07)*(1.0f/7.0f);
+    color[2] = (pixel & 0x03)*(1.0f/3.0f);
+    color[3] = 1.0f;
+}
+
+static inline void sw_get_pixel_bgra_8888(float *color, const void *pixels, uint32_t offset)
+{
+    const uint8_t *pixel = (uint8_t *)pixels + 4*offset;
+
+    color[0] = (float)pixel[2]*(1.0f/255);
+    color[1] = (float)pixel[1]*(1.0f/255);
+    color[2] = (float)pixel[0]*(1.0f/255);
+    color[3] = (float)pixel[3]*(1.0f/255);
+}
+
+static inline void sw_get_pixel_depth(float *color, const void *pixels, uint32_t offset)
+{
+    float depth = sw_framebuffer_read_depth((uint8_t *)pixels + offset*SW_DEPTH_PIXEL_SIZE);
+
+    color[0] = depth;
+    color[1] = depth;
+    color[2] = depth;
+    color[3] = 1.0f;
+}
+
 static inline void sw_get_pixel(float *color, const void *pixels, uint32_t offset, sw_pixelformat_t format)
 {
     switch (format)
@@ -2149,6 +3463,9 @@ static inline void sw_get_pixel(float *color, const void *pixels, uint32_t offse
         case SW_PIXELFORMAT_UNCOMPRESSED_R16: sw_get_pixel_red_16(color, pixels, offset); break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: sw_get_pixel_rgb_161616(color, pixels, offset); break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_get_pixel_rgba_16161616(color, pixels, offset); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R3G3B2: sw_get_pixel_rgb_332(color, pixels, offset); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_B8G8R8A8: sw_get_pixel_bgra_8888(color, pixels, offset); break;
+        case SW_PIXELFORMAT_DEPTH: sw_get_pixel_depth(color, pixels, offset); break;
         case SW_PIXELFORMAT_UNKNOWN: break;
         default: break;
     }
@@ -2156,18 +3473,87 @@ static inline void sw_get_pixel(float *color, const void *pixels, uint32_t offse
 
 // Texture sampling functionality
 
+// Offset of a texel in the texture storage
+// NOTE: Tiled textures store each 4x4 texel block contiguously, blocks in rows
+static inline int sw_texture_texel_offset(const sw_texture_t *tex, int x, int y)
+{
+    if (SW_TEXTURE_TILED && tex->tiled) return (((y >> 2)*tex->tileStride + (x >> 2)) << 4) + ((y & 3) << 2) + (x & 3);
+
+    return y*tex->width + x;
+}
+
 static inline void sw_texture_sample_nearest(float *color, const sw_texture_t *tex, float u, float v)
 {
     u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
     v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
 
-    int x = u*tex->width, y = v*tex->height;
+    // NOTE: Saturated (or rounded up fractional) coordinates of 1.0 map to the last texel
+    int x = sw_clampi(u*tex->width, 0, tex->width - 1);
+    int y = sw_clampi(v*tex->height, 0, tex->height - 1);
+
+    sw_get_pixel(color, tex->pixels.cptr, sw_texture_texel_offset(tex, x, y), tex->format);
+}
+
+// Interpolate the four 8-bit channels of two packed texels, 't' in [0..256]
+// NOTE: Channels are processed in pairs (0x00FF00FF masks) so there is room for the 8-bit weight products
+static inline uint32_t sw_lerp_rgba8(uint32_t a, uint32_t b, uint32_t t)
+{
+    uint32_t rb = ((a & 0x00FF00FF)*(256 - t) + (b & 0x00FF00FF)*t) >> 8;
+    uint32_t ga = (((a >> 8) & 0x00FF00FF)*(256 - t) + ((b >> 8) & 0x00FF00FF)*t) >> 8;
+
+    return (rb & 0x00FF00FF) | ((ga & 0x00FF00FF) << 8);
+}
+
+static inline uint32_t sw_texture_fetch_rgba8(const sw_texture_t *tex, int x, int y)
+{
+    const uint8_t *pixel = (const uint8_t *)tex->pixels.cptr + 4*sw_texture_texel_offset(tex, x, y);
+
+    return (uint32_t)pixel[0] | ((uint32_t)pixel[1] << 8) | ((uint32_t)pixel[2] << 16) | ((uint32_t)pixel[3] << 24);
+}
+
+static inline int sw_texture_wrap(int i, int size, int sizeMinus1, SWwrap wrap, bool isPOT)
+{
+    if (wrap == SW_CLAMP) return sw_clampi(i, 0, sizeMinus1);
+    if (isPOT) return i & sizeMinus1;
+    return (i%size + size)%size;
+}
+
+// Bilinear filtering of RGBA8 textures in fixed point (8 fractional bits), result is packed
+static inline uint32_t sw_texture_filter_rgba8(const sw_texture_t *tex, float u, float v)
+{
+    int xf = sw_floori(u*tex->width*256.0f) - 128;
+    int yf = sw_floori(v*tex->height*256.0f) - 128;
+
+    uint32_t fx = xf & 0xFF;
+    uint32_t fy = yf & 0xFF;
+
+    int x0 = sw_texture_wrap(xf >> 8, tex->width, tex->wMinus1, tex->sWrap, tex->isPOT);
+    int x1 = sw_texture_wrap((xf >> 8) + 1, tex->width, tex->wMinus1, tex->sWrap, tex->isPOT);
+    int y0 = sw_texture_wrap(yf >> 8, tex->height, tex->hMinus1, tex->tWrap, tex->isPOT);
+    int y1 = sw_texture_wrap((yf >> 8) + 1, tex->height, tex->hMinus1, tex->tWrap, tex->isPOT);
+
+    uint32_t t = sw_lerp_rgba8(sw_texture_fetch_rgba8(tex, x0, y0), sw_texture_fetch_rgba8(tex, x1, y0), fx);
+    uint32_t b = sw_lerp_rgba8(sw_texture_fetch_rgba8(tex, x0, y1), sw_texture_fetch_rgba8(tex, x1, y1), fx);
+
+    return sw_lerp_rgba8(t, b, fy);
+}
 
-    sw_get_pixel(color, tex->pixels.cptr, y*tex->width + x, tex->format);
+static inline void sw_texture_unpack_rgba8(float *color, uint32_t c)
+{
+    color[0] = (float)(c & 0xFF)*(1.0f/255);
+    color[1] = (float)((c >> 8) & 0xFF)*(1.0f/255);
+    color[2] = (float)((c >> 16) & 0xFF)*(1.0f/255);
+    color[3] = (float)(c >> 24)*(1.0f/255);
 }
 
 static inline void sw_texture_sample_linear(float *color, const sw_texture_t *tex, float u, float v)
 {
+    if (tex->format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        sw_texture_unpack_rgba8(color, sw_texture_filter_rgba8(tex, u, v));
+        return;
+    }
+
     // TODO: REVIEW: With a bit more cleverness we could clearly reduce the
     // number of operations here, but for now it works fine.
 
@@ -2188,6 +3574,11 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
         x0 = (x0 > tex->wMinus1)? tex->wMinus1 : x0;
         x1 = (x1 > tex->wMinus1)? tex->wMinus1 : x1;
     }
+    else if (tex->isPOT)
+    {
+        x0 &= tex->wMinus1;
+        x1 &= tex->wMinus1;
+    }
     else
     {
         x0 = (x0%tex->width + tex->width)%tex->width;
@@ -2199,6 +3590,11 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
         y0 = (y0 > tex->hMinus1)? tex->hMinus1 : y0;
         y1 = (y1 > tex->hMinus1)? tex->hMinus1 : y1;
     }
+    else if (tex->isPOT)
+    {
+        y0 &= tex->hMinus1;
+        y1 &= tex->hMinus1;
+    }
     else
     {
         y0 = (y0%tex->height + tex->height)%tex->height;
@@ -2206,10 +3602,10 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
     }
 
     float c00[4], c10[4], c01[4], c11[4];
-    sw_get_pixel(c00, tex->pixels.cptr, y0*tex->width + x0, tex->format);
-    sw_get_pixel(c10, tex->pixels.cptr, y0*tex->width + x1, tex->format);
-    sw_get_pixel(c01, tex->pixels.cptr, y1*tex->width + x0, tex->format);
-    sw_get_pixel(c11, tex->pixels.cptr, y1*tex->width + x1, tex->format);
+    sw_get_pixel(c00, tex->pixels.cptr, sw_texture_texel_offset(tex, x0, y0), tex->format);
+    sw_get_pixel(c10, tex->pixels.cptr, sw_texture_texel_offset(tex, x1, y0), tex->format);
+    sw_get_pixel(c01, tex->pixels.cptr, sw_texture_texel_offset(tex, x0, y1), tex->format);
+    sw_get_pixel(c11, tex->pixels.cptr, sw_texture_texel_offset(tex, x1, y1), tex->format);
 
     for (int i = 0; i < 4; i++)
     {
@@ -2219,7 +3615,12 @@ static inline void sw_texture_sample_linear(float *color, const sw_texture_t *te
     }
 }
 
-static inline void sw_texture_sample(float *color, const sw_texture_t *tex, float u, float v, float duDx, float duDy, float dvDx, float dvDy)
+static inline const sw_texture_t *sw_texture_get_level(const sw_texture_t *tex, int level)
+{
+    return (level == 0)? tex : &tex->mipmaps[level - 1];
+}
+
+static inline void sw_texture_get_lod(sw_texture_lod_t *lod, const sw_texture_t *tex, float duDx, float duDy, float dvDx, float dvDy)
 {
     // Previous method: There is no need to compute the square root
     // because using the squared value, the comparison remains `L2 > 1.0f*1.0f`
@@ -2227,19 +3628,131 @@ static inline void sw_texture_sample(float *color, const sw_texture_t *tex, floa
     //float dv = sqrtf(dvDx*dvDx + dvDy*dvDy);
     //float L = (du > dv)? du : dv;
 
-    // Calculate the derivatives for each axis
-    float du2 = duDx*duDx + duDy*duDy;
-    float dv2 = dvDx*dvDx + dvDy*dvDy;
+    // Calculate the derivatives for each axis, in texels
+    float du2 = (duDx*duDx + duDy*duDy)*(float)(tex->width*tex->width);
+    float dv2 = (dvDx*dvDx + dvDy*dvDy)*(float)(tex->height*tex->height);
     float L2 = (du2 > dv2)? du2 : dv2;
 
-    SWfilter filter = (L2 > 1.0f)? tex->minFilter : tex->magFilter;
+    lod->level = tex;
+    lod->nextLevel = NULL;
+    lod->blend = 0.0f;
 
-    switch (filter)
+    if (L2 <= 1.0f)
     {
-        case SW_NEAREST: sw_texture_sample_nearest(color, tex, u, v); break;
-        case SW_LINEAR: sw_texture_sample_linear(color, tex, u, v); break;
-        default: break;
+        lod->filter = tex->magFilter;
+        return;
+    }
+
+    switch (tex->minFilter)
+    {
+        case SW_NEAREST_MIPMAP_NEAREST:
+        case SW_NEAREST_MIPMAP_LINEAR: lod->filter = SW_NEAREST; break;
+        case SW_LINEAR_MIPMAP_NEAREST:
+        case SW_LINEAR_MIPMAP_LINEAR: lod->filter = SW_LINEAR; break;
+        default: lod->filter = tex->minFilter; return;
+    }
+
+    // Level of detail: log2(L) == log2(L2)/2, limited to the defined levels
+    float lambda = 0.5f*log2f(L2);
+    float maxLevel = (float)(tex->mipmapCount - 1);
+    if (lambda > maxLevel) lambda = maxLevel;
+
+    if ((tex->minFilter == SW_NEAREST_MIPMAP_NEAREST) || (tex->minFilter == SW_LINEAR_MIPMAP_NEAREST))
+    {
+        lod->level = sw_texture_get_level(tex, (int)(lambda + 0.5f));
+    }
+    else
+    {
+        int level = (int)lambda;
+        lod->level = sw_texture_get_level(tex, level);
+        lod->blend = lambda - (float)level;
+        if (lod->blend > 0.0f) lod->nextLevel = sw_texture_get_level(tex, level + 1);
+    }
+}
+
+// Level of detail selection for perspective-correct interpolation, where 's' and 't' are the
+// pixel texture coordinates, 'wRcp' the pixel w and the derivatives the ones of the interpolated
+// u/w, v/w and 1/w: ds/dx = (d(u/w)/dx - s*d(1/w)/dx)*w
+// NOTE: The derivatives of 's' and 't' change along the span, the level is selected per pixel
+static inline void sw_texture_get_lod_perspective(sw_texture_lod_t *lod, const sw_texture_t *tex, float s, float t, float wRcp,
+                                                  float duDx, float duDy, float dvDx, float dvDy, float dwDx, float dwDy)
+{
+    sw_texture_get_lod(lod, tex,
+        (duDx - s*dwDx)*wRcp, (duDy - s*dwDy)*wRcp,
+        (dvDx - t*dwDx)*wRcp, (dvDy - t*dwDy)*wRcp);
+}
+
+// Sampling of two mipmap levels blended together (trilinear filtering)
+// NOTE: Kept out of line so the single level path stays small enough to be inlined in the spans
+static void sw_texture_sample_levels(float *color, const sw_texture_lod_t *lod, float u, float v)
+{
+    const sw_texture_t *level = lod->level;
+    const sw_texture_t *next = lod->nextLevel;
+
+    if ((lod->filter == SW_LINEAR) &&
+        (level->format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+        (next->format == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        uint32_t c = sw_lerp_rgba8(sw_texture_filter_rgba8(level, u, v), sw_texture_filter_rgba8(next, u, v), (uint32_t)(lod->blend*256.0f));
+        sw_texture_unpack_rgba8(color, c);
+        return;
+    }
+
+    float nextColor[4];
+    if (lod->filter == SW_LINEAR)
+    {
+        sw_texture_sample_linear(color, level, u, v);
+        sw_texture_sample_linear(nextColor, next, u, v);
+    }
+    else
+    {
+        sw_texture_sample_nearest(color, level, u, v);
+        sw_texture_sample_nearest(nextColor, next, u, v);
+    }
+
+    color[0] += lod->blend*(nextColor[0] - color[0]);
+    color[1] += lod->blend*(nextColor[1] - color[1]);
+    color[2] += lod->blend*(nextColor[2] - color[2]);
+    color[3] += lod->blend*(nextColor[3] - color[3]);
+}
+
+static inline void sw_texture_sample_lod(float *color, const sw_texture_lod_t *lod, float u, float v)
+{
+    SW_STATS_ADD(texelsFetched, ((lod->filter == SW_LINEAR)? 4 : 1)*((lod->nextLevel != NULL)? 2 : 1));
+
+    if (lod->nextLevel != NULL) sw_texture_sample_levels(color, lod, u, v);
+    else if (lod->filter == SW_LINEAR) sw_texture_sample_linear(color, lod->level, u, v);
+    else sw_texture_sample_nearest(color, lod->level, u, v);
+}
+
+// Sampling of RGBA8 textures without pixel format dispatch, used by the specialized span functions
+static inline void sw_texture_sample_lod_rgba8(float *color, const sw_texture_lod_t *lod, float u, float v)
+{
+    const sw_texture_t *tex = lod->level;
+
+    // NOTE: Mipmap levels can be defined with other formats
+    if ((lod->nextLevel != NULL) || (tex->format != SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        sw_texture_sample_lod(color, lod, u, v);
+        return;
+    }
+
+    if (lod->filter == SW_LINEAR)
+    {
+        SW_STATS_ADD(texelsFetched, 4);
+        sw_texture_unpack_rgba8(color, sw_texture_filter_rgba8(tex, u, v));
+        return;
     }
+
+    SW_STATS_ADD(texelsFetched, 1);
+
+    u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
+    v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
+
+    int x = sw_clampi(u*tex->width, 0, tex->width - 1);
+    int y = sw_clampi(v*tex->height, 0, tex->height - 1);
+
+    sw_texture_unpack_rgba8(color, sw_texture_fetch_rgba8(tex, x, y));
 }
 
 // Color Blending functionality
@@ -2317,18 +3830,317 @@ static inline void sw_blend_colors(float *SW_RESTRICT dst/*[4]*/, const float *S
     dst[3] = srcFactor[3]*src[3] + dstFactor[3]*dst[3];
 }
 
-// Projection helper functions
+// NOTE: Vector versions operate on one vector per channel (SW_SIMD_WIDTH pixels)
+static inline void sw_factor_simd(sw_simd_t factor[4], SWfactor mode, const sw_simd_t src[4], const sw_simd_t dst[4])
+{
+    const sw_simd_t one = sw_simd_set1(1.0f);
 
-static inline void sw_project_ndc_to_screen(float screen[2], const float ndc[4])
+    switch (mode)
+    {
+        case SW_ONE: factor[0] = factor[1] = factor[2] = factor[3] = one; break;
+        case SW_SRC_COLOR: factor[0] = src[0]; factor[1] = src[1]; factor[2] = src[2]; factor[3] = src[3]; break;
+        case SW_ONE_MINUS_SRC_COLOR:
+        {
+            factor[0] = sw_simd_sub(one, src[0]); factor[1] = sw_simd_sub(one, src[1]);
+            factor[2] = sw_simd_sub(one, src[2]); factor[3] = sw_simd_sub(one, src[3]);
+        } break;
+        case SW_SRC_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = src[3]; break;
+        case SW_ONE_MINUS_SRC_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = sw_simd_sub(one, src[3]); break;
+        case SW_DST_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = dst[3]; break;
+        case SW_ONE_MINUS_DST_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = sw_simd_sub(one, dst[3]); break;
+        case SW_DST_COLOR: factor[0] = dst[0]; factor[1] = dst[1]; factor[2] = dst[2]; factor[3] = dst[3]; break;
+        case SW_ONE_MINUS_DST_COLOR:
+        {
+            factor[0] = sw_simd_sub(one, dst[0]); factor[1] = sw_simd_sub(one, dst[1]);
+            factor[2] = sw_simd_sub(one, dst[2]); factor[3] = sw_simd_sub(one, dst[3]);
+        } break;
+        case SW_SRC_ALPHA_SATURATE:
+        {
+            factor[0] = factor[1] = factor[2] = one;
+            factor[3] = sw_simd_min(src[3], one);
+        } break;
+        case SW_ZERO:
+        default: factor[0] = factor[1] = factor[2] = factor[3] = sw_simd_set1(0.0f); break;
+    }
+}
+
+static inline void sw_blend_colors_simd(sw_simd_t dst[4], const sw_simd_t src[4])
 {
-    screen[0] = RLSW.vpCenter[0] + ndc[0]*RLSW.vpHalfSize[0];
-    screen[1] = RLSW.vpCenter[1] - ndc[1]*RLSW.vpHalfSize[1];
+    sw_simd_t srcFactor[4], dstFactor[4];
+
+    sw_factor_simd(srcFactor, RLSW.srcFactor, src, dst);
+    sw_factor_simd(dstFactor, RLSW.dstFactor, src, dst);
+
+    dst[0] = sw_simd_add(sw_simd_mul(srcFactor[0], src[0]), sw_simd_mul(dstFactor[0], dst[0]));
+    dst[1] = sw_simd_add(sw_simd_mul(srcFactor[1], src[1]), sw_simd_mul(dstFactor[1], dst[1]));
+    dst[2] = sw_simd_add(sw_simd_mul(srcFactor[2], src[2]), sw_simd_mul(dstFactor[2], dst[2]));
+    dst[3] = sw_simd_add(sw_simd_mul(srcFactor[3], src[3]), sw_simd_mul(dstFactor[3], dst[3]));
 }
 
-// Polygon Clipping management
+// Blending with factors known at compile time, same operations as the generic path
+static inline void sw_blend_colors_simd_mode(sw_simd_t dst[4], const sw_simd_t src[4], sw_blend_mode_t mode)
+{
+    const sw_simd_t one = sw_simd_set1(1.0f);
 
-#define DEFINE_CLIP_FUNC(name, FUNC_IS_INSIDE, FUNC_COMPUTE_T)                          \
-static inline int sw_clip_##name(                                                       \
+    switch (mode)
+    {
+        case SW_BLEND_MODE_ALPHA:
+        {
+            sw_simd_t invAlpha = sw_simd_sub(one, src[3]);
+            dst[0] = sw_simd_add(sw_simd_mul(src[3], src[0]), sw_simd_mul(invAlpha, dst[0]));
+            dst[1] = sw_simd_add(sw_simd_mul(src[3], src[1]), sw_simd_mul(invAlpha, dst[1]));
+            dst[2] = sw_simd_add(sw_simd_mul(src[3], src[2]), sw_simd_mul(invAlpha, dst[2]));
+            dst[3] = sw_simd_add(sw_simd_mul(src[3], src[3]), sw_simd_mul(invAlpha, dst[3]));
+        } break;
+        case SW_BLEND_MODE_ADDITIVE:
+        {
+            dst[0] = sw_simd_add(sw_simd_mul(src[3], src[0]), dst[0]);
+            dst[1] = sw_simd_add(sw_simd_mul(src[3], src[1]), dst[1]);
+            dst[2] = sw_simd_add(sw_simd_mul(src[3], src[2]), dst[2]);
+            dst[3] = sw_simd_add(sw_simd_mul(src[3], src[3]), dst[3]);
+        } break;
+        case SW_BLEND_MODE_ALPHA_PREMULTIPLY:
+        {
+            sw_simd_t invAlpha = sw_simd_sub(one, src[3]);
+            dst[0] = sw_simd_add(src[0], sw_simd_mul(invAlpha, dst[0]));
+            dst[1] = sw_simd_add(src[1], sw_simd_mul(invAlpha, dst[1]));
+            dst[2] = sw_simd_add(src[2], sw_simd_mul(invAlpha, dst[2]));
+            dst[3] = sw_simd_add(src[3], sw_simd_mul(invAlpha, dst[3]));
+        } break;
+        default: sw_blend_colors_simd(dst, src); break;
+    }
+}
+
+// Span rasterization functionality
+// NOTE: Spans are processed SW_SIMD_WIDTH pixels at a time, interpolation, perspective
+// division, depth test, blending and pixel conversions are vectorized; texel fetches
+// and the final byte loads/stores remain per pixel since they depend on the pixel formats
+
+#define DEFINE_SPAN_SIMD(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, BLEND_MODE, ENABLE_PERSPECTIVE, TEXTURE_FORMAT) \
+static inline void FUNC_NAME(void *cptr, void *dptr, int count, const sw_span_t *span) \
+{                                                                                   \
+    const sw_simd_t zero = sw_simd_set1(0.0f);                                      \
+    const sw_simd_t one = sw_simd_set1(1.0f);                                       \
+                                                                                    \
+    /* Position of each lane from the span origin, values are evaluated at it */    \
+    /* (not stepped) so they match the scalar rasterizers and do not depend on clipping */ \
+    sw_simd_t lanePosition = sw_simd_ramp((float)span->offset, 1.0f);               \
+                                                                                    \
+    sw_texture_lod_t lod = { 0 };                                                   \
+    bool lodReady = false;                                                          \
+                                                                                    \
+    for (int x = 0; x < count; x += SW_SIMD_WIDTH)                                  \
+    {                                                                               \
+        /* Mask of the lanes inside the span */                                     \
+        int lanes = count - x;                                                      \
+        if (lanes > SW_SIMD_WIDTH) lanes = SW_SIMD_WIDTH;                           \
+        uint32_t mask = (1u << lanes) - 1;                                          \
+                                                                                    \
+        sw_simd_t position = sw_simd_add(lanePosition, sw_simd_set1((float)x));     \
+        sw_simd_t z = sw_simd_linear(span->z, span->dzDx, position);                \
+                                                                                    \
+        /* Test and write depth */                                                  \
+        if (ENABLE_DEPTH_TEST)                                                      \
+        {                                                                           \
+            /* TODO: Implement different depth funcs? */                            \
+            uint32_t depthMask = sw_simd_mask_le(z, sw_framebuffer_read_depth_simd(dptr, lanes)); \
+            SW_STATS_ADD(fragmentsDepthRejected, sw_stats_count_bits(mask & ~depthMask)); \
+            mask &= depthMask;                                                      \
+            if (mask == 0) goto next;                                               \
+        }                                                                           \
+                                                                                    \
+        sw_framebuffer_write_depth_simd(dptr, z, mask);                             \
+                                                                                    \
+        /* Pixel color computation */                                               \
+        sw_simd_t srcColor[4];                                                      \
+        srcColor[0] = sw_simd_linear(span->color[0], span->dcDx[0], position);      \
+        srcColor[1] = sw_simd_linear(span->color[1], span->dcDx[1], position);      \
+        srcColor[2] = sw_simd_linear(span->color[2], span->dcDx[2], position);      \
+        srcColor[3] = sw_simd_linear(span->color[3], span->dcDx[3], position);      \
+        sw_simd_t wRcp = one;                                                       \
+        if (ENABLE_PERSPECTIVE) {                                                   \
+            wRcp = sw_simd_div(one, sw_simd_linear(span->w, span->dwDx, position)); \
+            srcColor[0] = sw_simd_mul(srcColor[0], wRcp);                           \
+            srcColor[1] = sw_simd_mul(srcColor[1], wRcp);                           \
+            srcColor[2] = sw_simd_mul(srcColor[2], wRcp);                           \
+            srcColor[3] = sw_simd_mul(srcColor[3], wRcp);                           \
+        }                                                                           \
+                                                                                    \
+        if (ENABLE_TEXTURE)                                                         \
+        {                                                                           \
+            /* Texture level(s) and filter, constant along affine spans, selected */ \
+            /* once a pixel is visible, perspective ones are selected per pixel */  \
+            if (!ENABLE_PERSPECTIVE && !lodReady)                                   \
+            {                                                                       \
+                sw_texture_get_lod(&lod, span->tex, span->duDx, span->duDy, span->dvDx, span->dvDy); \
+                lodReady = true;                                                    \
+            }                                                                       \
+                                                                                    \
+            sw_simd_t u = sw_simd_linear(span->u, span->duDx, position);            \
+            sw_simd_t v = sw_simd_linear(span->v, span->dvDx, position);            \
+            float s[SW_SIMD_WIDTH], t[SW_SIMD_WIDTH], q[SW_SIMD_WIDTH];             \
+            float texColor[4][SW_SIMD_WIDTH] = { 0 };                               \
+            sw_simd_store(s, ENABLE_PERSPECTIVE? sw_simd_mul(u, wRcp) : u);         \
+            sw_simd_store(t, ENABLE_PERSPECTIVE? sw_simd_mul(v, wRcp) : v);         \
+            if (ENABLE_PERSPECTIVE) sw_simd_store(q, wRcp);                         \
+            for (int i = 0; i < SW_SIMD_WIDTH; i++)                                 \
+            {                                                                       \
+                if (!(mask & (1u << i))) continue;                                  \
+                if (ENABLE_PERSPECTIVE) {                                           \
+                    sw_texture_get_lod_perspective(&lod, span->tex, s[i], t[i], q[i], \
+                        span->duDx, span->duDy, span->dvDx, span->dvDy, span->dwDx, span->dwDy); \
+                }                                                                   \
+                float texel[4];                                                     \
+                if (TEXTURE_FORMAT == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {       \
+                    sw_texture_sample_lod_rgba8(texel, &lod, s[i], t[i]);           \
+                }                                                                   \
+                else sw_texture_sample_lod(texel, &lod, s[i], t[i]);                \
+                texColor[0][i] = texel[0];                                          \
+                texColor[1][i] = texel[1];                                          \
+                texColor[2][i] = texel[2];                                          \
+                texColor[3][i] = texel[3];                                          \
+            }                                                                       \
+            srcColor[0] = sw_simd_mul(srcColor[0], sw_simd_load(texColor[0]));      \
+            srcColor[1] = sw_simd_mul(srcColor[1], sw_simd_load(texColor[1]));      \
+            srcColor[2] = sw_simd_mul(srcColor[2], sw_simd_load(texColor[2]));      \
+            srcColor[3] = sw_simd_mul(srcColor[3], sw_simd_load(texColor[3]));      \
+        }                                                                           \
+                                                                                    \
+        if (BLEND_MODE != SW_BLEND_MODE_NONE)                                       \
+        {                                                                           \
+            sw_simd_t dstColor[4];                                                  \
+            SW_STATS_ADD(fragmentsBlended, sw_stats_count_bits(mask));              \
+            sw_framebuffer_read_color_simd(dstColor, cptr, lanes);                  \
+            sw_blend_colors_simd_mode(dstColor, srcColor, BLEND_MODE);              \
+            srcColor[0] = sw_simd_min(sw_simd_max(dstColor[0], zero), one);         \
+            srcColor[1] = sw_simd_min(sw_simd_max(dstColor[1], zero), one);         \
+            srcColor[2] = sw_simd_min(sw_simd_max(dstColor[2], zero), one);         \
+            srcColor[3] = dstColor[3];                                              \
+        }                                                                           \
+                                                                                    \
+        /* Pack the colors of the visible pixels */                                 \
+        SW_STATS_ADD(fragmentsShaded, sw_stats_count_bits(mask));                   \
+        sw_framebuffer_write_color_simd(cptr, srcColor, mask);                      \
+                                                                                    \
+        /* Increment the pointers */                                                \
+    next:                                                                           \
+        cptr = sw_framebuffer_get_color_addr(cptr, SW_SIMD_WIDTH);                  \
+        dptr = sw_framebuffer_get_depth_addr(dptr, SW_SIMD_WIDTH);                  \
+    }                                                                               \
+}
+
+DEFINE_SPAN_SIMD(sw_triangle_span_simd, 0, 0, 0, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX, 1, 0, 0, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_DEPTH, 0, 1, 0, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_BLEND, 0, 0, 1, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH, 1, 1, 0, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_BLEND, 1, 0, 1, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_DEPTH_BLEND, 0, 1, 1, 1, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH_BLEND, 1, 1, 1, 1, SW_PIXELFORMAT_UNKNOWN)
+
+DEFINE_SPAN_SIMD(sw_quad_span_simd, 0, 0, 0, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX, 1, 0, 0, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_DEPTH, 0, 1, 0, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_BLEND, 0, 0, 1, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH, 1, 1, 0, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_BLEND, 1, 0, 1, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_DEPTH_BLEND, 0, 1, 1, 0, SW_PIXELFORMAT_UNKNOWN)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH_BLEND, 1, 1, 1, 0, SW_PIXELFORMAT_UNKNOWN)
+
+// Spans specialized for the states raylib uses the most: RGBA8 textures with the default blend modes
+#define RGBA8 SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_RGBA8, 1, 0, SW_BLEND_MODE_NONE, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH_RGBA8, 1, 1, SW_BLEND_MODE_NONE, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_BLEND_ALPHA_RGBA8, 1, 0, SW_BLEND_MODE_ALPHA, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH_BLEND_ALPHA_RGBA8, 1, 1, SW_BLEND_MODE_ALPHA, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_BLEND_ADDITIVE_RGBA8, 1, 0, SW_BLEND_MODE_ADDITIVE, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH_BLEND_ADDITIVE_RGBA8, 1, 1, SW_BLEND_MODE_ADDITIVE, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_BLEND_PREMUL_RGBA8, 1, 0, SW_BLEND_MODE_ALPHA_PREMULTIPLY, 1, RGBA8)
+DEFINE_SPAN_SIMD(sw_triangle_span_simd_TEX_DEPTH_BLEND_PREMUL_RGBA8, 1, 1, SW_BLEND_MODE_ALPHA_PREMULTIPLY, 1, RGBA8)
+
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_RGBA8, 1, 0, SW_BLEND_MODE_NONE, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH_RGBA8, 1, 1, SW_BLEND_MODE_NONE, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_BLEND_ALPHA_RGBA8, 1, 0, SW_BLEND_MODE_ALPHA, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH_BLEND_ALPHA_RGBA8, 1, 1, SW_BLEND_MODE_ALPHA, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_BLEND_ADDITIVE_RGBA8, 1, 0, SW_BLEND_MODE_ADDITIVE, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH_BLEND_ADDITIVE_RGBA8, 1, 1, SW_BLEND_MODE_ADDITIVE, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_BLEND_PREMUL_RGBA8, 1, 0, SW_BLEND_MODE_ALPHA_PREMULTIPLY, 0, RGBA8)
+DEFINE_SPAN_SIMD(sw_quad_span_simd_TEX_DEPTH_BLEND_PREMUL_RGBA8, 1, 1, SW_BLEND_MODE_ALPHA_PREMULTIPLY, 0, RGBA8)
+#undef RGBA8
+
+// Pipeline selection functionality
+
+static inline sw_blend_mode_t sw_blend_mode_get(SWfactor srcFactor, SWfactor dstFactor)
+{
+    if ((srcFactor == SW_SRC_ALPHA) && (dstFactor == SW_ONE_MINUS_SRC_ALPHA)) return SW_BLEND_MODE_ALPHA;
+    if ((srcFactor == SW_SRC_ALPHA) && (dstFactor == SW_ONE)) return SW_BLEND_MODE_ADDITIVE;
+    if ((srcFactor == SW_ONE) && (dstFactor == SW_ONE_MINUS_SRC_ALPHA)) return SW_BLEND_MODE_ALPHA_PREMULTIPLY;
+    return SW_BLEND_MODE_GENERIC;
+}
+
+// Select the span functions for the current state, only done when the state has changed
+// NOTE: Called before rasterizing primitives, the spans no longer branch on the blend factors
+// or texture format per pixel when a specialized version exists, the generic ones are used otherwise
+static inline void sw_pipeline_update(void)
+{
+    sw_pipeline_t *pipeline = &RLSW.pipeline;
+
+    uint32_t stateFlags = RLSW.stateFlags & (SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND);
+    sw_pixelformat_t texFormat = (stateFlags & SW_STATE_TEXTURE_2D)? RLSW.loadedTextures[RLSW.currentTexture].format : SW_PIXELFORMAT_UNKNOWN;
+
+    if ((pipeline->triangleSpan != NULL) && (pipeline->stateFlags == stateFlags) &&
+        (pipeline->srcFactor == RLSW.srcFactor) && (pipeline->dstFactor == RLSW.dstFactor) &&
+        (pipeline->texFormat == texFormat)) return;
+
+    pipeline->stateFlags = stateFlags;
+    pipeline->srcFactor = RLSW.srcFactor;
+    pipeline->dstFactor = RLSW.dstFactor;
+    pipeline->texFormat = texFormat;
+
+    bool depth = ((stateFlags & SW_STATE_DEPTH_TEST) != 0);
+    sw_blend_mode_t blendMode = (stateFlags & SW_STATE_BLEND)? sw_blend_mode_get(RLSW.srcFactor, RLSW.dstFactor) : SW_BLEND_MODE_NONE;
+
+    #define PIPELINE_SELECT(SUFFIX)                                 \
+    {                                                               \
+        pipeline->triangleSpan = sw_triangle_span_simd##SUFFIX;     \
+        pipeline->quadSpan = sw_quad_span_simd##SUFFIX;             \
+    }
+
+    if ((texFormat == SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (blendMode != SW_BLEND_MODE_GENERIC))
+    {
+        switch (blendMode)
+        {
+            case SW_BLEND_MODE_ALPHA: if (depth) PIPELINE_SELECT(_TEX_DEPTH_BLEND_ALPHA_RGBA8) else PIPELINE_SELECT(_TEX_BLEND_ALPHA_RGBA8) break;
+            case SW_BLEND_MODE_ADDITIVE: if (depth) PIPELINE_SELECT(_TEX_DEPTH_BLEND_ADDITIVE_RGBA8) else PIPELINE_SELECT(_TEX_BLEND_ADDITIVE_RGBA8) break;
+            case SW_BLEND_MODE_ALPHA_PREMULTIPLY: if (depth) PIPELINE_SELECT(_TEX_DEPTH_BLEND_PREMUL_RGBA8) else PIPELINE_SELECT(_TEX_BLEND_PREMUL_RGBA8) break;
+            default: if (depth) PIPELINE_SELECT(_TEX_DEPTH_RGBA8) else PIPELINE_SELECT(_TEX_RGBA8) break;
+        }
+    }
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) PIPELINE_SELECT(_TEX_DEPTH_BLEND)
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) PIPELINE_SELECT(_DEPTH_BLEND)
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) PIPELINE_SELECT(_TEX_BLEND)
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) PIPELINE_SELECT(_TEX_DEPTH)
+    else if (SW_STATE_CHECK(SW_STATE_BLEND)) PIPELINE_SELECT(_BLEND)
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) PIPELINE_SELECT(_DEPTH)
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) PIPELINE_SELECT(_TEX)
+    else PIPELINE_SELECT()
+
+    #undef PIPELINE_SELECT
+}
+
+// Projection helper functions
+
+static inline void sw_project_ndc_to_screen(float screen[2], const float ndc[4])
+{
+    screen[0] = RLSW.vpCenter[0] + ndc[0]*RLSW.vpHalfSize[0];
+    screen[1] = RLSW.framebuffer.bottomUp? RLSW.vpCenter[1] + ndc[1]*RLSW.vpHalfSize[1]
+                                         : RLSW.vpCenter[1] - ndc[1]*RLSW.vpHalfSize[1];
+}
+
+// Polygon Clipping management
+
+#define DEFINE_CLIP_FUNC(name, FUNC_IS_INSIDE, FUNC_COMPUTE_T)                          \
+static inline int sw_clip_##name(                                                       \
     sw_vertex_t output[SW_MAX_CLIPPED_POLYGON_VERTICES],                                \
     const sw_vertex_t input[SW_MAX_CLIPPED_POLYGON_VERTICES],                           \
     int n)                                                                              \
@@ -2360,20 +4172,23 @@ static inline int sw_clip_##name(
 }
 
 // Frustum cliping functions
+// NOTE: Polygons are only clipped against the x/y planes of the guard band, a clip space
+// area SW_CLIP_GUARD_BAND times larger than the viewport, the viewport and scissor
+// rectangle are applied by the rasterizer, see sw_raster_bounds_restrict()
 
 #define IS_INSIDE_PLANE_W(h) ((h)[3] >= SW_CLIP_EPSILON)
-#define IS_INSIDE_PLANE_X_POS(h) ((h)[0] <= (h)[3])
-#define IS_INSIDE_PLANE_X_NEG(h) (-(h)[0] <= (h)[3])
-#define IS_INSIDE_PLANE_Y_POS(h) ((h)[1] <= (h)[3])
-#define IS_INSIDE_PLANE_Y_NEG(h) (-(h)[1] <= (h)[3])
+#define IS_INSIDE_PLANE_X_POS(h) ((h)[0] <= SW_CLIP_GUARD_BAND*(h)[3])
+#define IS_INSIDE_PLANE_X_NEG(h) (-(h)[0] <= SW_CLIP_GUARD_BAND*(h)[3])
+#define IS_INSIDE_PLANE_Y_POS(h) ((h)[1] <= SW_CLIP_GUARD_BAND*(h)[3])
+#define IS_INSIDE_PLANE_Y_NEG(h) (-(h)[1] <= SW_CLIP_GUARD_BAND*(h)[3])
 #define IS_INSIDE_PLANE_Z_POS(h) ((h)[2] <= (h)[3])
 #define IS_INSIDE_PLANE_Z_NEG(h) (-(h)[2] <= (h)[3])
 
 #define COMPUTE_T_PLANE_W(hPrev, hCurr) ((SW_CLIP_EPSILON - (hPrev)[3])/((hCurr)[3] - (hPrev)[3]))
-#define COMPUTE_T_PLANE_X_POS(hPrev, hCurr) (((hPrev)[3] - (hPrev)[0])/(((hPrev)[3] - (hPrev)[0]) - ((hCurr)[3] - (hCurr)[0])))
-#define COMPUTE_T_PLANE_X_NEG(hPrev, hCurr) (((hPrev)[3] + (hPrev)[0])/(((hPrev)[3] + (hPrev)[0]) - ((hCurr)[3] + (hCurr)[0])))
-#define COMPUTE_T_PLANE_Y_POS(hPrev, hCurr) (((hPrev)[3] - (hPrev)[1])/(((hPrev)[3] - (hPrev)[1]) - ((hCurr)[3] - (hCurr)[1])))
-#define COMPUTE_T_PLANE_Y_NEG(hPrev, hCurr) (((hPrev)[3] + (hPrev)[1])/(((hPrev)[3] + (hPrev)[1]) - ((hCurr)[3] + (hCurr)[1])))
+#define COMPUTE_T_PLANE_X_POS(hPrev, hCurr) ((SW_CLIP_GUARD_BAND*(hPrev)[3] - (hPrev)[0])/((SW_CLIP_GUARD_BAND*(hPrev)[3] - (hPrev)[0]) - (SW_CLIP_GUARD_BAND*(hCurr)[3] - (hCurr)[0])))
+#define COMPUTE_T_PLANE_X_NEG(hPrev, hCurr) ((SW_CLIP_GUARD_BAND*(hPrev)[3] + (hPrev)[0])/((SW_CLIP_GUARD_BAND*(hPrev)[3] + (hPrev)[0]) - (SW_CLIP_GUARD_BAND*(hCurr)[3] + (hCurr)[0])))
+#define COMPUTE_T_PLANE_Y_POS(hPrev, hCurr) ((SW_CLIP_GUARD_BAND*(hPrev)[3] - (hPrev)[1])/((SW_CLIP_GUARD_BAND*(hPrev)[3] - (hPrev)[1]) - (SW_CLIP_GUARD_BAND*(hCurr)[3] - (hCurr)[1])))
+#define COMPUTE_T_PLANE_Y_NEG(hPrev, hCurr) ((SW_CLIP_GUARD_BAND*(hPrev)[3] + (hPrev)[1])/((SW_CLIP_GUARD_BAND*(hPrev)[3] + (hPrev)[1]) - (SW_CLIP_GUARD_BAND*(hCurr)[3] + (hCurr)[1])))
 #define COMPUTE_T_PLANE_Z_POS(hPrev, hCurr) (((hPrev)[3] - (hPrev)[2])/(((hPrev)[3] - (hPrev)[2]) - ((hCurr)[3] - (hCurr)[2])))
 #define COMPUTE_T_PLANE_Z_NEG(hPrev, hCurr) (((hPrev)[3] + (hPrev)[2])/(((hPrev)[3] + (hPrev)[2]) - ((hCurr)[3] + (hCurr)[2])))
 
@@ -2385,32 +4200,64 @@ DEFINE_CLIP_FUNC(y_neg, IS_INSIDE_PLANE_Y_NEG, COMPUTE_T_PLANE_Y_NEG)
 DEFINE_CLIP_FUNC(z_pos, IS_INSIDE_PLANE_Z_POS, COMPUTE_T_PLANE_Z_POS)
 DEFINE_CLIP_FUNC(z_neg, IS_INSIDE_PLANE_Z_NEG, COMPUTE_T_PLANE_Z_NEG)
 
-// Scissor clip functions
-
-#define COMPUTE_T_SCISSOR_X_MIN(hPrev, hCurr) (((RLSW.scClipMin[0])*(hPrev)[3] - (hPrev)[0])/(((hCurr)[0] - (RLSW.scClipMin[0])*(hCurr)[3]) - ((hPrev)[0] - (RLSW.scClipMin[0])*(hPrev)[3])))
-#define COMPUTE_T_SCISSOR_X_MAX(hPrev, hCurr) (((RLSW.scClipMax[0])*(hPrev)[3] - (hPrev)[0])/(((hCurr)[0] - (RLSW.scClipMax[0])*(hCurr)[3]) - ((hPrev)[0] - (RLSW.scClipMax[0])*(hPrev)[3])))
-#define COMPUTE_T_SCISSOR_Y_MIN(hPrev, hCurr) (((RLSW.scClipMin[1])*(hPrev)[3] - (hPrev)[1])/(((hCurr)[1] - (RLSW.scClipMin[1])*(hCurr)[3]) - ((hPrev)[1] - (RLSW.scClipMin[1])*(hPrev)[3])))
-#define COMPUTE_T_SCISSOR_Y_MAX(hPrev, hCurr) (((RLSW.scClipMax[1])*(hPrev)[3] - (hPrev)[1])/(((hCurr)[1] - (RLSW.scClipMax[1])*(hCurr)[3]) - ((hPrev)[1] - (RLSW.scClipMax[1])*(hPrev)[3])))
-
-#define IS_INSIDE_SCISSOR_X_MIN(h) ((h)[0] >= (RLSW.scClipMin[0])*(h)[3])
-#define IS_INSIDE_SCISSOR_X_MAX(h) ((h)[0] <= (RLSW.scClipMax[0])*(h)[3])
-#define IS_INSIDE_SCISSOR_Y_MIN(h) ((h)[1] >= (RLSW.scClipMin[1])*(h)[3])
-#define IS_INSIDE_SCISSOR_Y_MAX(h) ((h)[1] <= (RLSW.scClipMax[1])*(h)[3])
-
-DEFINE_CLIP_FUNC(scissor_x_min, IS_INSIDE_SCISSOR_X_MIN, COMPUTE_T_SCISSOR_X_MIN)
-DEFINE_CLIP_FUNC(scissor_x_max, IS_INSIDE_SCISSOR_X_MAX, COMPUTE_T_SCISSOR_X_MAX)
-DEFINE_CLIP_FUNC(scissor_y_min, IS_INSIDE_SCISSOR_Y_MIN, COMPUTE_T_SCISSOR_Y_MIN)
-DEFINE_CLIP_FUNC(scissor_y_max, IS_INSIDE_SCISSOR_Y_MAX, COMPUTE_T_SCISSOR_Y_MAX)
+// Outcodes of a vertex, the planes crossed by a polygon are clipped only
+#define SW_CLIP_W               (1 << 0)
+#define SW_CLIP_X_POS           (1 << 1)
+#define SW_CLIP_X_NEG           (1 << 2)
+#define SW_CLIP_Y_POS           (1 << 3)
+#define SW_CLIP_Y_NEG           (1 << 4)
+#define SW_CLIP_Z_POS           (1 << 5)
+#define SW_CLIP_Z_NEG           (1 << 6)
+#define SW_CLIP_VIEW_X_POS      (1 << 7)     // Outside the viewport, not necessarily the guard band
+#define SW_CLIP_VIEW_X_NEG      (1 << 8)
+#define SW_CLIP_VIEW_Y_POS      (1 << 9)
+#define SW_CLIP_VIEW_Y_NEG      (1 << 10)
+
+static inline uint32_t sw_clip_outcode(const float h[4])
+{
+    uint32_t code = 0;
+
+    if (!IS_INSIDE_PLANE_W(h)) code |= SW_CLIP_W;
+    if (!IS_INSIDE_PLANE_X_POS(h)) code |= SW_CLIP_X_POS;
+    if (!IS_INSIDE_PLANE_X_NEG(h)) code |= SW_CLIP_X_NEG;
+    if (!IS_INSIDE_PLANE_Y_POS(h)) code |= SW_CLIP_Y_POS;
+    if (!IS_INSIDE_PLANE_Y_NEG(h)) code |= SW_CLIP_Y_NEG;
+    if (!IS_INSIDE_PLANE_Z_POS(h)) code |= SW_CLIP_Z_POS;
+    if (!IS_INSIDE_PLANE_Z_NEG(h)) code |= SW_CLIP_Z_NEG;
+    if (h[0] > h[3]) code |= SW_CLIP_VIEW_X_POS;
+    if (-h[0] > h[3]) code |= SW_CLIP_VIEW_X_NEG;
+    if (h[1] > h[3]) code |= SW_CLIP_VIEW_Y_POS;
+    if (-h[1] > h[3]) code |= SW_CLIP_VIEW_Y_NEG;
+
+    return code;
+}
 
 // Main clip function
 
 static inline bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES], int *vertexCounter)
 {
-    static sw_vertex_t tmp[SW_MAX_CLIPPED_POLYGON_VERTICES];
+    sw_vertex_t tmp[SW_MAX_CLIPPED_POLYGON_VERTICES];
 
     int n = *vertexCounter;
 
-    #define CLIP_AGAINST_PLANE(FUNC_CLIP)                       \
+    // Polygons entirely outside one of the planes are rejected, the ones
+    // inside all of them (most polygons) are left untouched
+    uint32_t codeAnd = 0xFFFFFFFF, codeOr = 0;
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t code = sw_clip_outcode(polygon[i].homogeneous);
+        codeAnd &= code;
+        codeOr |= code;
+    }
+
+    if (codeAnd != 0)
+    {
+        *vertexCounter = 0;
+        return false;
+    }
+
+    #define CLIP_AGAINST_PLANE(PLANE, FUNC_CLIP)                \
+    if (codeOr & (PLANE))                                       \
     {                                                           \
         n = FUNC_CLIP(tmp, polygon, n);                         \
         if (n < 3)                                              \
@@ -2421,27 +4268,448 @@ static inline bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VE
         for (int i = 0; i < n; i++) polygon[i] = tmp[i];        \
     }
 
-    CLIP_AGAINST_PLANE(sw_clip_w);
-    CLIP_AGAINST_PLANE(sw_clip_x_pos);
-    CLIP_AGAINST_PLANE(sw_clip_x_neg);
-    CLIP_AGAINST_PLANE(sw_clip_y_pos);
-    CLIP_AGAINST_PLANE(sw_clip_y_neg);
-    CLIP_AGAINST_PLANE(sw_clip_z_pos);
-    CLIP_AGAINST_PLANE(sw_clip_z_neg);
+    CLIP_AGAINST_PLANE(SW_CLIP_W, sw_clip_w);
+    CLIP_AGAINST_PLANE(SW_CLIP_X_POS, sw_clip_x_pos);
+    CLIP_AGAINST_PLANE(SW_CLIP_X_NEG, sw_clip_x_neg);
+    CLIP_AGAINST_PLANE(SW_CLIP_Y_POS, sw_clip_y_pos);
+    CLIP_AGAINST_PLANE(SW_CLIP_Y_NEG, sw_clip_y_neg);
+    CLIP_AGAINST_PLANE(SW_CLIP_Z_POS, sw_clip_z_pos);
+    CLIP_AGAINST_PLANE(SW_CLIP_Z_NEG, sw_clip_z_neg);
 
-    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
-    {
-        CLIP_AGAINST_PLANE(sw_clip_scissor_x_min);
-        CLIP_AGAINST_PLANE(sw_clip_scissor_x_max);
-        CLIP_AGAINST_PLANE(sw_clip_scissor_y_min);
-        CLIP_AGAINST_PLANE(sw_clip_scissor_y_max);
-    }
+    #undef CLIP_AGAINST_PLANE
 
     *vertexCounter = n;
 
     return (n >= 3);
 }
 
+#if SW_ENABLE_BINNING
+// Tile binning recording logic
+
+static void sw_bin_flush(void);
+
+static inline bool sw_bin_is_active(void)
+{
+    return (RLSW_BINNER.threadCount > 1);
+}
+
+static inline bool sw_bin_reserve(void **buffer, int *capacity, int required, int elementSize)
+{
+    if (required <= *capacity) return true;
+
+    int newCapacity = (*capacity > 0)? *capacity : 64;
+    while (newCapacity < required) newCapacity *= 2;
+
+    void *newBuffer = SW_REALLOC(*buffer, newCapacity*elementSize);
+    if (newBuffer == NULL) return false;
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+
+    return true;
+}
+
+static inline bool sw_bin_state_equal(const sw_bin_state_t *a, const sw_bin_state_t *b)
+{
+    return (a->stateFlags == b->stateFlags) && (a->currentTexture == b->currentTexture) &&
+           (a->srcFactor == b->srcFactor) && (a->dstFactor == b->dstFactor) &&
+           (a->srcFactorFunc == b->srcFactorFunc) && (a->dstFactorFunc == b->dstFactorFunc) &&
+           (a->pointRadius == b->pointRadius) && (a->lineWidth == b->lineWidth) &&
+           (a->vpCenter[0] == b->vpCenter[0]) && (a->vpCenter[1] == b->vpCenter[1]) &&
+           (a->vpHalfSize[0] == b->vpHalfSize[0]) && (a->vpHalfSize[1] == b->vpHalfSize[1]) &&
+           (a->vpMin[0] == b->vpMin[0]) && (a->vpMin[1] == b->vpMin[1]) &&
+           (a->vpMax[0] == b->vpMax[0]) && (a->vpMax[1] == b->vpMax[1]) &&
+           (a->scMin[0] == b->scMin[0]) && (a->scMin[1] == b->scMin[1]) &&
+           (a->scMax[0] == b->scMax[0]) && (a->scMax[1] == b->scMax[1]) &&
+           (a->clearColor[0] == b->clearColor[0]) && (a->clearColor[1] == b->clearColor[1]) &&
+           (a->clearColor[2] == b->clearColor[2]) && (a->clearColor[3] == b->clearColor[3]) &&
+           (a->clearDepth == b->clearDepth);
+}
+
+static inline int sw_bin_push_state(void)
+{
+    sw_binner_t *binner = &RLSW_BINNER;
+
+    sw_bin_state_t state = { 0 };
+    state.stateFlags = RLSW.stateFlags;
+    state.currentTexture = RLSW.currentTexture;
+    state.srcFactor = RLSW.srcFactor;
+    state.dstFactor = RLSW.dstFactor;
+    state.srcFactorFunc = RLSW.srcFactorFunc;
+    state.dstFactorFunc = RLSW.dstFactorFunc;
+    state.pointRadius = RLSW.pointRadius;
+    state.lineWidth = RLSW.lineWidth;
+    for (int i = 0; i < 2; i++)
+    {
+        state.vpCenter[i] = RLSW.vpCenter[i];
+        state.vpHalfSize[i] = RLSW.vpHalfSize[i];
+        state.vpMin[i] = RLSW.vpMin[i];
+        state.vpMax[i] = RLSW.vpMax[i];
+        state.scMin[i] = RLSW.scMin[i];
+        state.scMax[i] = RLSW.scMax[i];
+    }
+    for (int i = 0; i < 4; i++) state.clearColor[i] = RLSW.clearColor[i];
+    state.clearDepth = RLSW.clearDepth;
+
+    // Consecutive commands usually share the same state
+    if ((binner->stateCount > 0) && sw_bin_state_equal(&binner->states[binner->stateCount - 1], &state))
+    {
+        return binner->stateCount - 1;
+    }
+
+    if (!sw_bin_reserve((void **)&binner->states, &binner->stateCapacity, binner->stateCount + 1, sizeof(sw_bin_state_t))) return -1;
+
+    binner->states[binner->stateCount] = state;
+
+    return binner->stateCount++;
+}
+
+// Record a projected primitive (or a clear) into the bins it overlaps
+// NOTE: Returns false if binning is disabled or recording failed, the command must then be rasterized immediately
+static bool sw_bin_push(sw_bin_cmd_type_t type, const sw_vertex_t *vertices, int count, uint32_t clearMask)
+{
+    sw_binner_t *binner = &RLSW_BINNER;
+
+    if (!sw_bin_is_active()) return false;
+
+    // Compute the range of tiles covered by the primitive bounding box
+    int tx0 = 0, ty0 = 0;
+    int tx1 = binner->tilesX - 1;
+    int ty1 = binner->tilesY - 1;
+
+    if (type != SW_BIN_CMD_CLEAR)
+    {
+        float xMin = vertices[0].screen[0], xMax = xMin;
+        float yMin = vertices[0].screen[1], yMax = yMin;
+
+        for (int i = 1; i < count; i++)
+        {
+            if (vertices[i].screen[0] < xMin) xMin = vertices[i].screen[0];
+            if (vertices[i].screen[0] > xMax) xMax = vertices[i].screen[0];
+            if (vertices[i].screen[1] < yMin) yMin = vertices[i].screen[1];
+            if (vertices[i].screen[1] > yMax) yMax = vertices[i].screen[1];
+        }
+
+        // Conservative margin covering pixel center rounding, line width and point radius
+        float margin = 1.0f;
+        if (type == SW_BIN_CMD_LINE) margin += RLSW.lineWidth;
+        else if (type == SW_BIN_CMD_POINT) margin += RLSW.pointRadius;
+
+        int x0 = (int)floorf(xMin - margin), x1 = (int)ceilf(xMax + margin);
+        int y0 = (int)floorf(yMin - margin), y1 = (int)ceilf(yMax + margin);
+
+        if ((x1 < 0) || (y1 < 0) || (x0 >= RLSW.framebuffer.width) || (y0 >= RLSW.framebuffer.height)) return true;
+
+        tx0 = sw_clampi(x0, 0, RLSW.framebuffer.width - 1)/SW_BINNING_TILE_SIZE;
+        ty0 = sw_clampi(y0, 0, RLSW.framebuffer.height - 1)/SW_BINNING_TILE_SIZE;
+        tx1 = sw_clampi(x1, 0, RLSW.framebuffer.width - 1)/SW_BINNING_TILE_SIZE;
+        ty1 = sw_clampi(y1, 0, RLSW.framebuffer.height - 1)/SW_BINNING_TILE_SIZE;
+    }
+
+    int stateIndex = sw_bin_push_state();
+
+    if ((stateIndex < 0) ||
+        !sw_bin_reserve((void **)&binner->commands, &binner->commandCapacity, binner->commandCount + 1, sizeof(sw_bin_cmd_t)) ||
+        !sw_bin_reserve((void **)&binner->vertices, &binner->vertexCapacity, binner->vertexCount + count, sizeof(sw_vertex_t)))
+    {
+        // Out of memory, rasterize what has been recorded so far and let the caller render immediately
+        sw_bin_flush();
+        return false;
+    }
+
+    uint32_t cmdIndex = binner->commandCount;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            sw_bin_t *bin = &binner->bins[ty*binner->tilesX + tx];
+
+            if (!sw_bin_reserve((void **)&bin->commands, &bin->capacity, bin->count + 1, sizeof(uint32_t)))
+            {
+                // Remove the command from the bins it was already added to
+                for (int i = ty0*binner->tilesX + tx0; i < ty*binner->tilesX + tx; i++)
+                {
+                    sw_bin_t *prev = &binner->bins[i];
+                    if ((prev->count > 0) && (prev->commands[prev->count - 1] == cmdIndex)) prev->count--;
+                }
+
+                sw_bin_flush();
+                return false;
+            }
+
+            bin->commands[bin->count++] = cmdIndex;
+        }
+    }
+
+    sw_bin_cmd_t *cmd = &binner->commands[binner->commandCount++];
+    cmd->type = type;
+    cmd->stateIndex = stateIndex;
+    cmd->firstVertex = binner->vertexCount;
+    cmd->vertexCount = count;
+    cmd->clearMask = clearMask;
+
+    for (int i = 0; i < count; i++) binner->vertices[binner->vertexCount++] = vertices[i];
+
+    return true;
+}
+#endif // SW_ENABLE_BINNING
+
+// Record the screen bounding box of a primitive as modified
+static inline void sw_framebuffer_mark_vertices(const sw_vertex_t *vertices, int count, float margin)
+{
+    float xMin = vertices[0].screen[0], xMax = xMin;
+    float yMin = vertices[0].screen[1], yMax = yMin;
+
+    for (int i = 1; i < count; i++)
+    {
+        if (vertices[i].screen[0] < xMin) xMin = vertices[i].screen[0];
+        if (vertices[i].screen[0] > xMax) xMax = vertices[i].screen[0];
+        if (vertices[i].screen[1] < yMin) yMin = vertices[i].screen[1];
+        if (vertices[i].screen[1] > yMax) yMax = vertices[i].screen[1];
+    }
+
+    sw_framebuffer_mark((int)floorf(xMin - margin), (int)floorf(yMin - margin), (int)ceilf(xMax + margin) + 1, (int)ceilf(yMax + margin) + 1);
+}
+
+// Restrict the rasterization bounds to the viewport and scissor rectangle,
+// polygons are only clipped geometrically against the guard band
+// NOTE: Returns false if nothing is left to rasterize, the previous bounds
+// are saved to be restored with sw_raster_bounds_restore()
+static inline bool sw_raster_bounds_restrict(int saved[4])
+{
+    int min[2], max[2];
+
+    for (int i = 0; i < 2; i++)
+    {
+        saved[i] = RLSW.rasterMin[i];
+        saved[i + 2] = RLSW.rasterMax[i];
+
+        min[i] = RLSW.vpCenter[i] - RLSW.vpHalfSize[i];
+        max[i] = RLSW.vpCenter[i] + RLSW.vpHalfSize[i];
+
+        if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+        {
+            if (RLSW.scMin[i] > min[i]) min[i] = RLSW.scMin[i];
+            if (RLSW.scMax[i] < max[i]) max[i] = RLSW.scMax[i];
+        }
+
+        if (min[i] > RLSW.rasterMin[i]) RLSW.rasterMin[i] = min[i];
+        if (max[i] < RLSW.rasterMax[i]) RLSW.rasterMax[i] = max[i];
+    }
+
+    return (RLSW.rasterMin[0] < RLSW.rasterMax[0]) && (RLSW.rasterMin[1] < RLSW.rasterMax[1]);
+}
+
+static inline void sw_raster_bounds_restore(const int saved[4])
+{
+    for (int i = 0; i < 2; i++)
+    {
+        RLSW.rasterMin[i] = saved[i];
+        RLSW.rasterMax[i] = saved[i + 2];
+    }
+}
+
+// Anti-aliasing logic
+// NOTE: There are no multisampled buffers, with SW_MULTISAMPLE the edges of the polygons are recorded
+// and anti-aliased in a pass once the framebuffer is read or presented (or before a state change
+// the pass depends on): the pixel crossed by an edge is blended with its neighbor on the other side
+// of the edge, weighted by the part of the pixel beyond it. The cost only depends on the length of
+// the edges, edges shared by two polygons of the pass (interior edges) cancel out and are left
+// untouched, whether they were drawn by the same draw call or not
+
+#define SW_EDGE_DEPTH_EPSILON   (4.0f/(float)((1u << SW_DEPTH_BUFFER_BITS) - 1))   // Depth units hiding an edge
+
+static void sw_edge_list_resolve(void);
+
+static inline bool sw_edge_list_is_active(void)
+{
+    // NOTE: Only the main framebuffer is anti-aliased, as with multisampled default framebuffers
+    return ((RLSW.stateFlags & SW_STATE_MULTISAMPLE) && (RLSW.currentFramebuffer == 0));
+}
+
+static inline int sw_edge_hash(const sw_edge_t *edge)
+{
+    const float coords[4] = { edge->x0, edge->y0, edge->x1, edge->y1 };
+    uint32_t hash = 2166136261u;
+
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t bits;
+        memcpy(&bits, &coords[i], sizeof(uint32_t));
+        hash = (hash ^ bits)*16777619u;
+    }
+
+    // Integer coordinates leave the low bits empty, they are mixed with the high ones
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352Du;
+    hash ^= hash >> 15;
+
+    return (int)(hash%(2*SW_MAX_AA_EDGES));
+}
+
+static inline void sw_edge_list_push(const sw_vertex_t *a, const sw_vertex_t *b)
+{
+    // Edges lying on pixel boundaries along the axes do not cross any pixel
+    if ((a->screen[0] == b->screen[0]) && (a->screen[0] == floorf(a->screen[0]))) return;
+    if ((a->screen[1] == b->screen[1]) && (a->screen[1] == floorf(a->screen[1]))) return;
+
+    if ((b->screen[1] < a->screen[1]) || ((b->screen[1] == a->screen[1]) && (b->screen[0] < a->screen[0])))
+    {
+        const sw_vertex_t *tmp = a; a = b; b = tmp;
+    }
+
+    sw_edge_t edge = {
+        a->screen[0], a->screen[1], a->homogeneous[2],
+        b->screen[0], b->screen[1], b->homogeneous[2],
+        -1, 0, false
+    };
+
+    edge.bucket = sw_edge_hash(&edge);
+
+    // The vertices shared by two polygons are transformed the same way, their edges match exactly
+    for (int i = RLSW.edges.buckets[edge.bucket]; i >= 0; i = RLSW.edges.data[i].next)
+    {
+        sw_edge_t *other = &RLSW.edges.data[i];
+        if ((other->x0 == edge.x0) && (other->y0 == edge.y0) && (other->x1 == edge.x1) && (other->y1 == edge.y1))
+        {
+            other->interior = !other->interior;
+            return;
+        }
+    }
+
+    edge.next = RLSW.edges.buckets[edge.bucket];
+    RLSW.edges.buckets[edge.bucket] = RLSW.edges.count;
+    RLSW.edges.data[RLSW.edges.count++] = edge;
+}
+
+// Record the edges of a projected polygon, before it is rasterized
+static inline void sw_edge_list_record(const sw_vertex_t *polygon, int count)
+{
+    if (RLSW.edges.data == NULL)
+    {
+        RLSW.edges.data = SW_MALLOC(SW_MAX_AA_EDGES*sizeof(sw_edge_t));
+        RLSW.edges.buckets = SW_MALLOC(2*SW_MAX_AA_EDGES*sizeof(int));
+
+        if ((RLSW.edges.data == NULL) || (RLSW.edges.buckets == NULL))
+        {
+            SW_FREE(RLSW.edges.data);
+            SW_FREE(RLSW.edges.buckets);
+            RLSW.edges.data = NULL;
+            RLSW.edges.buckets = NULL;
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+            return;
+        }
+
+        for (int i = 0; i < 2*SW_MAX_AA_EDGES; i++) RLSW.edges.buckets[i] = -1;
+    }
+
+    // Large scenes are anti-aliased in several passes, the polygons recorded so far are rasterized
+    if (RLSW.edges.count + count > SW_MAX_AA_EDGES) sw_edge_list_resolve();
+
+    for (int i = 0; i < count; i++) sw_edge_list_push(&polygon[i], &polygon[(i + 1)%count]);
+}
+
+// Blend the pixels crossed by an edge with their neighbor on the other side of it
+static inline void sw_edge_resolve(const sw_edge_t *edge, bool depthTest)
+{
+    const float p0[3] = { edge->x0, edge->y0, edge->z0 };
+    const float p1[3] = { edge->x1, edge->y1, edge->z1 };
+
+    // The edge is walked one pixel at a time along its major axis, crossing pixels along the minor axis
+    int major = (fabsf(p1[0] - p0[0]) >= fabsf(p1[1] - p0[1]))? 0 : 1;
+    int minor = 1 - major;
+
+    const float *a = (p0[major] < p1[major])? p0 : p1;
+    const float *b = (p0[major] < p1[major])? p1 : p0;
+
+    float length = b[major] - a[major];
+    if (length < 1e-6f) return;
+
+    float slope = (b[minor] - a[minor])/length;
+    float zSlope = (b[2] - a[2])/length;
+
+    int start = sw_floori(a[major] + 0.5f);
+    int end = sw_floori(b[major] + 0.5f);
+    if (start < RLSW.rasterMin[major]) start = RLSW.rasterMin[major];
+    if (end > RLSW.rasterMax[major]) end = RLSW.rasterMax[major];
+
+    const int size[2] = { RLSW.framebuffer.width, RLSW.framebuffer.height };
+    const int stride[2] = { 1, RLSW.framebuffer.width };
+
+    for (int i = start; i < end; i++)
+    {
+        float t = (float)i + 0.5f - a[major];
+        float c = a[minor] + slope*t;
+
+        // Pixel crossed by the edge, the part beyond the edge takes the color of the neighbor
+        int j = sw_floori(c);
+        float offset = c - ((float)j + 0.5f);
+        float weight = 0.5f - fabsf(offset);
+        int k = (offset >= 0.0f)? j + 1 : j - 1;
+
+        if (weight < 1.0f/512.0f) continue;
+        if ((j < RLSW.rasterMin[minor]) || (j >= RLSW.rasterMax[minor]) || (k < 0) || (k >= size[minor])) continue;
+
+        int pixel = i*stride[major] + j*stride[minor];
+        int neighbor = i*stride[major] + k*stride[minor];
+
+        // Edges hidden on both sides by closer surfaces are left untouched
+        if (depthTest)
+        {
+            float depth = fmaxf(sw_framebuffer_read_depth(sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, pixel)),
+                                sw_framebuffer_read_depth(sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, neighbor)));
+            if (a[2] + zSlope*t > depth + SW_EDGE_DEPTH_EPSILON) continue;
+        }
+
+        void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, pixel);
+        const void *nptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, neighbor);
+        if (memcmp(cptr, nptr, SW_COLOR_PIXEL_SIZE) == 0) continue;
+
+        float color[4], other[4];
+        sw_framebuffer_read_color(color, cptr);
+        sw_framebuffer_read_color(other, nptr);
+
+        // NOTE: Rounded, so the truncating color writes do not drift
+        color[0] += (other[0] - color[0])*weight + 0.5f/255.0f;
+        color[1] += (other[1] - color[1])*weight + 0.5f/255.0f;
+        color[2] += (other[2] - color[2])*weight + 0.5f/255.0f;
+        color[3] += (other[3] - color[3])*weight + 0.5f/255.0f;
+
+        sw_framebuffer_write_color(cptr, color);
+    }
+}
+
+// Anti-alias the edges recorded so far, once their polygons are rasterized
+static void sw_edge_list_resolve(void)
+{
+    if (RLSW.edges.count == 0) return;
+
+#if SW_ENABLE_BINNING
+    // Pixels on both sides of the edges are read, whatever tile they belong to
+    sw_bin_flush();
+#endif
+
+    SW_STATS_TIMER_BEGIN();
+
+    int bounds[4];
+    if (sw_raster_bounds_restrict(bounds))
+    {
+        bool depthTest = ((RLSW.stateFlags & SW_STATE_DEPTH_TEST) != 0);
+
+        for (int i = 0; i < RLSW.edges.count; i++)
+        {
+            if (!RLSW.edges.data[i].interior) sw_edge_resolve(&RLSW.edges.data[i], depthTest);
+        }
+    }
+    sw_raster_bounds_restore(bounds);
+
+    for (int i = 0; i < RLSW.edges.count; i++) RLSW.edges.buckets[RLSW.edges.data[i].bucket] = -1;
+    RLSW.edges.count = 0;
+
+    SW_STATS_TIMER_END(rasterTime);
+}
+
 // Triangle rendering logic
 
 static inline bool sw_triangle_face_culling(void)
@@ -2532,11 +4800,13 @@ static inline void sw_triangle_clip_and_project(void)
 
 #define DEFINE_TRIANGLE_RASTER_SCANLINE(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
 static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,     \
-                             const sw_vertex_t *end, float duDy, float dvDy)        \
+                             const sw_vertex_t *end, float dxDy, float duDy,        \
+                             float dvDy, float dwDy)                                \
 {                                                                                   \
-    /* Convert and center the screen coordinates */                                 \
-    int xStart = (int)(start->screen[0] + 0.5f);                                    \
-    int xEnd   = (int)(end->screen[0] + 0.5f);                                      \
+    /* Convert and center the screen coordinates, the span origin is its unclipped start */ \
+    int xOrigin = sw_floori(start->screen[0] + 0.5f);                               \
+    int xStart = xOrigin;                                                           \
+    int xEnd   = sw_floori(end->screen[0] + 0.5f);                                  \
     int y      = (int)start->screen[1];                                             \
                                                                                     \
     /* Compute the inverse horizontal distance along the X axis */                  \
@@ -2558,56 +4828,81 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
     if (ENABLE_TEXTURE) {                                                           \
         duDx = (end->texcoord[0] - start->texcoord[0])*dxRcp;                       \
         dvDx = (end->texcoord[1] - start->texcoord[1])*dxRcp;                       \
+        /* Vertical derivatives, the gradients are given along the long edge */     \
+        duDy -= dxDy*duDx;                                                          \
+        dvDy -= dxDy*dvDx;                                                          \
+        dwDy -= dxDy*dwDx;                                                          \
     }                                                                               \
                                                                                     \
-    /* Initializing the interpolation starting values  */                           \
-    float z = start->homogeneous[2];                                                \
-    float w = start->homogeneous[3];                                                \
+    /* Restrict the span to the rasterization bounds */                             \
+    /* NOTE: Values are evaluated at each pixel distance from the origin, not stepped, */ \
+    /* so clipped spans (tiles, scissor) get the same values as unclipped ones */   \
+    if (xEnd > RLSW.rasterMax[0]) xEnd = RLSW.rasterMax[0];                         \
+    if (xStart < RLSW.rasterMin[0]) xStart = RLSW.rasterMin[0];                     \
+    if (xStart >= xEnd) return;                                                     \
                                                                                     \
-    float color[4] = { 0 };                                                         \
-    color[0] = start->color[0];                                                     \
-    color[1] = start->color[1];                                                     \
-    color[2] = start->color[2];                                                     \
-    color[3] = start->color[3];                                                     \
+    /* Reject the span if hidden, record its depth writes otherwise */              \
+    float zFirst = start->homogeneous[2] + dzDx*(float)(xStart - xOrigin);          \
+    float zLast = start->homogeneous[2] + dzDx*(float)(xEnd - 1 - xOrigin);         \
+    float zMin = (zFirst < zLast)? zFirst : zLast, zMax = (zFirst < zLast)? zLast : zFirst; \
+    if (ENABLE_DEPTH_TEST && !sw_hiz_test(xStart, y, xEnd, y + 1, zMin, false)) return; \
+    sw_hiz_update(xStart, y, xEnd, y + 1, zMin, zMax, ENABLE_DEPTH_TEST);           \
                                                                                     \
-    float u = 0.0f, v = 0.0f;                                                       \
-    if (ENABLE_TEXTURE) {                                                           \
-        u = start->texcoord[0];                                                     \
-        v = start->texcoord[1];                                                     \
+    /* Pre-calculate the starting pointers for the framebuffer row */               \
+    void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, y*RLSW.framebuffer.width + xStart); \
+    void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + xStart); \
+                                                                                    \
+    /* Vectorized scanline rasterization, when available */                         \
+    if (SW_SIMD_WIDTH > 1)                                                          \
+    {                                                                               \
+        sw_span_t span = {                                                          \
+            tex, start->homogeneous[2], start->homogeneous[3],                      \
+            { start->color[0], start->color[1], start->color[2], start->color[3] }, \
+            start->texcoord[0], start->texcoord[1], dzDx, dwDx,                     \
+            { dcDx[0], dcDx[1], dcDx[2], dcDx[3] },                                 \
+            duDx, dvDx, duDy, dvDy, dwDy, xStart - xOrigin                          \
+        };                                                                          \
+        RLSW.pipeline.triangleSpan(cptr, dptr, xEnd - xStart, &span);               \
+        return;                                                                     \
     }                                                                               \
                                                                                     \
-    /* Pre-calculate the starting pointers for the framebuffer row */               \
-    void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, y*RLSW.framebuffer.width + xStart);  \
-    void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + xStart);  \
+    /* Texture level(s) and filter, perspective changes them along the span */      \
+    sw_texture_lod_t lod = { 0 };                                                   \
                                                                                     \
     /* Scanline rasterization */                                                    \
     for (int x = xStart; x < xEnd; x++)                                             \
     {                                                                               \
+        float position = (float)(x - xOrigin);                                      \
+        float z = start->homogeneous[2] + dzDx*position;                            \
+                                                                                    \
         /* Test and write depth */                                                  \
         if (ENABLE_DEPTH_TEST)                                                      \
         {                                                                           \
             /* TODO: Implement different depth funcs? */                            \
             float depth =  sw_framebuffer_read_depth(dptr);                         \
-            if (z > depth) goto discard;                                            \
+            if (z > depth) { SW_STATS_ADD(fragmentsDepthRejected, 1); goto discard; } \
         }                                                                           \
                                                                                     \
         sw_framebuffer_write_depth(dptr, z);                                        \
+        SW_STATS_ADD(fragmentsShaded, 1);                                           \
                                                                                     \
         /* Pixel color computation */                                               \
-        float wRcp = 1.0f/w;                                                        \
+        float wRcp = 1.0f/(start->homogeneous[3] + dwDx*position);                  \
         float srcColor[4] = {                                                       \
-            color[0]*wRcp,                                                          \
-            color[1]*wRcp,                                                          \
-            color[2]*wRcp,                                                          \
-            color[3]*wRcp                                                           \
+            (start->color[0] + dcDx[0]*position)*wRcp,                              \
+            (start->color[1] + dcDx[1]*position)*wRcp,                              \
+            (start->color[2] + dcDx[2]*position)*wRcp,                              \
+            (start->color[3] + dcDx[3]*position)*wRcp                               \
         };                                                                          \
                                                                                     \
         if (ENABLE_TEXTURE)                                                         \
         {                                                                           \
             float texColor[4];                                                      \
-            float s = u*wRcp;                                                       \
-            float t = v*wRcp;                                                       \
-            sw_texture_sample(texColor, tex, s, t, duDx, duDy, dvDx, dvDy);         \
+            float s = (start->texcoord[0] + duDx*position)*wRcp;                    \
+            float t = (start->texcoord[1] + dvDx*position)*wRcp;                    \
+            sw_texture_get_lod_perspective(&lod, tex, s, t, wRcp,                   \
+                duDx, duDy, dvDx, dvDy, dwDx, dwDy);                                \
+            sw_texture_sample_lod(texColor, &lod, s, t);                            \
             srcColor[0] *= texColor[0];                                             \
             srcColor[1] *= texColor[1];                                             \
             srcColor[2] *= texColor[2];                                             \
@@ -2617,6 +4912,7 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
         if (ENABLE_COLOR_BLEND)                                                     \
         {                                                                           \
             float dstColor[4];                                                      \
+            SW_STATS_ADD(fragmentsBlended, 1);                                      \
             sw_framebuffer_read_color(dstColor, cptr);                              \
                                                                                     \
             sw_blend_colors(dstColor, srcColor);                                    \
@@ -2631,26 +4927,14 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
             sw_framebuffer_write_color(cptr, srcColor);                             \
         }                                                                           \
                                                                                     \
-        /* Increment the interpolation parameter, UVs, and pointers */              \
+        /* Increment the pointers */                                                \
     discard:                                                                        \
-        z += dzDx;                                                                  \
-        w += dwDx;                                                                  \
-        color[0] += dcDx[0];                                                        \
-        color[1] += dcDx[1];                                                        \
-        color[2] += dcDx[2];                                                        \
-        color[3] += dcDx[3];                                                        \
-        if (ENABLE_TEXTURE)                                                         \
-        {                                                                           \
-            u += duDx;                                                              \
-            v += dvDx;                                                              \
-        }                                                                           \
-                                                                                    \
         sw_framebuffer_inc_color_addr(&cptr);                                       \
         sw_framebuffer_inc_depth_addr(&dptr);                                       \
     }                                                                               \
 }
 
-#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, ENABLE_TEXTURE)            \
+#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, ENABLE_TEXTURE, ENABLE_DEPTH_TEST) \
 static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,          \
                              const sw_vertex_t *v2, const sw_texture_t *tex)        \
 {                                                                                   \
@@ -2682,9 +4966,9 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     float dx12 = (x2 - x1)*invH12;                                                  \
                                                                                     \
     /* Y bounds (vertical clipping) */                                              \
-    int yTop = (int)(y0 + 0.5f);                                                    \
-    int yMiddle = (int)(y1 + 0.5f);                                                 \
-    int yBottom = (int)(y2 + 0.5f);                                                 \
+    int yTop = sw_floori(y0 + 0.5f);                                                \
+    int yMiddle = sw_floori(y1 + 0.5f);                                             \
+    int yBottom = sw_floori(y2 + 0.5f);                                             \
                                                                                     \
     /* Compute gradients for each side of the triangle */                           \
     sw_vertex_t vDy02, vDy01, vDy12;                                                \
@@ -2692,40 +4976,64 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     sw_get_vertex_grad_PTCH(&vDy01, v0, v1, invH01);                                \
     sw_get_vertex_grad_PTCH(&vDy12, v1, v2, invH12);                                \
                                                                                     \
-    /* Initializing scanline variables */                                           \
-    sw_vertex_t vLeft = *v0;                                                        \
-    vLeft.screen[0] = x0;                                                           \
-    sw_vertex_t vRight = *v0;                                                       \
-    vRight.screen[0] = x0;                                                          \
+    /* Restrict the scanlines to the rasterization bounds */                        \
+    int yStart = (yTop < RLSW.rasterMin[1])? RLSW.rasterMin[1] : yTop;              \
+    int yEnd = (yBottom > RLSW.rasterMax[1])? RLSW.rasterMax[1] : yBottom;          \
+    int yUpperEnd = (yMiddle < yEnd)? yMiddle : yEnd;                               \
+                                                                                    \
+    /* Reject the whole triangle if hidden, large ones read dirty tiles back */     \
+    if (ENABLE_DEPTH_TEST && (yStart < yEnd))                                       \
+    {                                                                               \
+        int xMin = (int)fminf(fminf(x0, x1), x2);                                   \
+        int xMax = (int)fmaxf(fmaxf(x0, x1), x2) + 1;                               \
+        if (xMin < RLSW.rasterMin[0]) xMin = RLSW.rasterMin[0];                     \
+        if (xMax > RLSW.rasterMax[0]) xMax = RLSW.rasterMax[0];                     \
+        if (xMin >= xMax) return;                                                   \
+                                                                                    \
+        float zMin = fminf(fminf(v0->homogeneous[2], v1->homogeneous[2]),           \
+                           v2->homogeneous[2]);                                     \
+        int area = (xMax - xMin)*(yEnd - yStart);                                   \
+        bool refresh = (area >= 4*SW_HIZ_TILE_SIZE*SW_HIZ_TILE_SIZE);               \
+        if (!sw_hiz_test(xMin, yStart, xMax, yEnd, zMin, refresh)) return;          \
+    }                                                                               \
+                                                                                    \
+    /* Scanline edges, evaluated at the center of each scanline from the edge equations */ \
+    /* NOTE: Not stepped from row to row, so clipped triangles (tiles, scissor) get the same edges */ \
+    sw_vertex_t vLeft, vRight;                                                      \
                                                                                     \
     /* Scanline for the upper part of the triangle */                               \
-    for (int y = yTop; y < yMiddle; y++)                                            \
+    for (int y = yStart; y < yUpperEnd; y++)                                        \
     {                                                                               \
+        float yStep = (float)y + 0.5f - y0;                                         \
+        vLeft = *v0;                                                                \
+        sw_add_vertex_grad_scaled_PTCH(&vLeft, &vDy02, yStep);                      \
+        vLeft.screen[0] = x0 + dx02*yStep;                                          \
+        vRight = *v0;                                                               \
+        sw_add_vertex_grad_scaled_PTCH(&vRight, &vDy01, yStep);                     \
+        vRight.screen[0] = x0 + dx01*yStep;                                         \
         vLeft.screen[1] = vRight.screen[1] = y;                                     \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1]); \
-                                                                                    \
-        sw_add_vertex_grad_PTCH(&vLeft, &vDy02);                                    \
-        vLeft.screen[0]  += dx02;                                                   \
-        sw_add_vertex_grad_PTCH(&vRight, &vDy01);                                   \
-        vRight.screen[0] += dx01;                                                   \
+        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dx02, vDy02.texcoord[0], vDy02.texcoord[1], vDy02.homogeneous[3]); \
+        else FUNC_SCANLINE(tex, &vRight, &vLeft, dx02, vDy02.texcoord[0], vDy02.texcoord[1], vDy02.homogeneous[3]); \
     }                                                                               \
                                                                                     \
     /* Scanline for the lower part of the triangle */                               \
-    vRight = *v1, vRight.screen[0] = x1;                                            \
+    int yLowerStart = (yStart > yMiddle)? yStart : yMiddle;                         \
                                                                                     \
-    for (int y = yMiddle; y < yBottom; y++)                                         \
+    for (int y = yLowerStart; y < yEnd; y++)                                        \
     {                                                                               \
+        float yStep = (float)y + 0.5f - y0;                                         \
+        vLeft = *v0;                                                                \
+        sw_add_vertex_grad_scaled_PTCH(&vLeft, &vDy02, yStep);                      \
+        vLeft.screen[0] = x0 + dx02*yStep;                                          \
+        float yStep12 = (float)y + 0.5f - y1;                                       \
+        vRight = *v1;                                                               \
+        sw_add_vertex_grad_scaled_PTCH(&vRight, &vDy12, yStep12);                   \
+        vRight.screen[0] = x1 + dx12*yStep12;                                       \
         vLeft.screen[1] = vRight.screen[1] = y;                                     \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, vDy02.texcoord[0], vDy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, vDy02.texcoord[0], vDy02.texcoord[1]); \
-                                                                                    \
-        sw_add_vertex_grad_PTCH(&vLeft, &vDy02);                                    \
-        vLeft.screen[0]  += dx02;                                                   \
-        sw_add_vertex_grad_PTCH(&vRight, &vDy12);                                   \
-        vRight.screen[0] += dx12;                                                   \
+        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dx02, vDy02.texcoord[0], vDy02.texcoord[1], vDy02.homogeneous[3]); \
+        else FUNC_SCANLINE(tex, &vRight, &vLeft, dx02, vDy02.texcoord[0], vDy02.texcoord[1], vDy02.homogeneous[3]); \
     }                                                                               \
 }
 
@@ -2738,34 +5046,34 @@ DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX_BLEND, 1, 0, 1)
 DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_DEPTH_BLEND, 0, 1, 1)
 DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX_DEPTH_BLEND, 1, 1, 1)
 
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster, sw_triangle_raster_scanline, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX, sw_triangle_raster_scanline_TEX, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH, sw_triangle_raster_scanline_DEPTH, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_BLEND, sw_triangle_raster_scanline_BLEND, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH, sw_triangle_raster_scanline_TEX_DEPTH, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND, sw_triangle_raster_scanline_TEX_BLEND, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND, sw_triangle_raster_scanline_DEPTH_BLEND, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND, sw_triangle_raster_scanline_TEX_DEPTH_BLEND, true)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster, sw_triangle_raster_scanline, false, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX, sw_triangle_raster_scanline_TEX, true, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH, sw_triangle_raster_scanline_DEPTH, false, true)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_BLEND, sw_triangle_raster_scanline_BLEND, false, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH, sw_triangle_raster_scanline_TEX_DEPTH, true, true)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND, sw_triangle_raster_scanline_TEX_BLEND, true, false)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND, sw_triangle_raster_scanline_DEPTH_BLEND, false, true)
+DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND, sw_triangle_raster_scanline_TEX_DEPTH_BLEND, true, true)
 
-static inline void sw_triangle_render(void)
+static inline void sw_triangle_fan_rasterize(const sw_vertex_t *vertices, int count)
 {
-    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
+    int bounds[4];
+    if (!sw_raster_bounds_restrict(bounds))
     {
-        if (!sw_triangle_face_culling()) return;
+        sw_raster_bounds_restore(bounds);
+        return;
     }
 
-    sw_triangle_clip_and_project();
-
-    if (RLSW.vertexCounter < 3) return;
+    sw_pipeline_update();
 
     #define TRIANGLE_RASTER(RASTER_FUNC)                        \
     {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
+        for (int i = 0; i < count - 2; i++)                     \
         {                                                       \
             RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
+                &vertices[0],                                   \
+                &vertices[i + 1],                               \
+                &vertices[i + 2],                               \
                 &RLSW.loadedTextures[RLSW.currentTexture]       \
             );                                                  \
         }                                                       \
@@ -2781,6 +5089,29 @@ static inline void sw_triangle_render(void)
     else TRIANGLE_RASTER(sw_triangle_raster)
 
     #undef TRIANGLE_RASTER
+
+    sw_raster_bounds_restore(bounds);
+}
+
+static inline void sw_triangle_render(void)
+{
+    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
+    {
+        if (!sw_triangle_face_culling()) { SW_STATS_ADD(primitivesCulled, 1); return; }
+    }
+
+    sw_triangle_clip_and_project();
+
+    if (RLSW.vertexCounter < 3) { SW_STATS_ADD(primitivesClipped, 1); return; }
+
+    sw_framebuffer_mark_vertices(RLSW.vertexBuffer, RLSW.vertexCounter, 1.0f);
+    if (sw_edge_list_is_active()) sw_edge_list_record(RLSW.vertexBuffer, RLSW.vertexCounter);
+
+#if SW_ENABLE_BINNING
+    if (sw_bin_push(SW_BIN_CMD_POLYGON, RLSW.vertexBuffer, RLSW.vertexCounter, 0)) return;
+#endif
+
+    sw_triangle_fan_rasterize(RLSW.vertexBuffer, RLSW.vertexCounter);
 }
 
 // Quad rendering logic
@@ -2900,7 +5231,7 @@ static inline bool sw_quad_is_axis_aligned(void)
     return ((horizontal == 2) && (vertical == 2));
 }
 
-static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
+static inline void sw_quad_sort_cw(const sw_vertex_t* *output, const sw_vertex_t *input)
 {
     // Sort 4 quad vertices into clockwise order with fixed layout:
     //
@@ -2913,7 +5244,6 @@ static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
     // - v1: top-right (minimum Y row, maximum X)
     // - v2: bottom-right (maximum Y, maximum X)
     // - v3: bottom-left (maximum Y, minimum X)
-    const sw_vertex_t *input = RLSW.vertexBuffer;
 
     // Separate vertices into top and bottom based on Y-coordinate
     const sw_vertex_t *top[2] = {NULL, NULL};
@@ -2978,10 +5308,10 @@ static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
 // still appear perfectly aligned from a certain point of view?
 // Because in that case, we would still need to perform perspective division for textures and colors...
 #define DEFINE_QUAD_RASTER_AXIS_ALIGNED(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
-static inline void FUNC_NAME(void)                                              \
+static inline void FUNC_NAME(const sw_vertex_t *vertices)                       \
 {                                                                               \
     const sw_vertex_t *sortedVerts[4];                                          \
-    sw_quad_sort_cw(sortedVerts);                                               \
+    sw_quad_sort_cw(sortedVerts, vertices);                                     \
                                                                                 \
     const sw_vertex_t *v0 = sortedVerts[0];                                     \
     const sw_vertex_t *v1 = sortedVerts[1];                                     \
@@ -2989,10 +5319,10 @@ static inline void FUNC_NAME(void)
     const sw_vertex_t *v3 = sortedVerts[3];                                     \
                                                                                 \
     /* Screen bounds (axis-aligned) */                                          \
-    int xMin = (int)(v0->screen[0] + 0.5f);                                     \
-    int yMin = (int)(v0->screen[1] + 0.5f);                                     \
-    int xMax = (int)(v2->screen[0] + 0.5f);                                     \
-    int yMax = (int)(v2->screen[1] + 0.5f);                                     \
+    int xMin = sw_floori(v0->screen[0] + 0.5f);                                 \
+    int yMin = sw_floori(v0->screen[1] + 0.5f);                                 \
+    int xMax = sw_floori(v2->screen[0] + 0.5f);                                 \
+    int yMax = sw_floori(v2->screen[1] + 0.5f);                                 \
                                                                                 \
     int width = xMax - xMin;                                                    \
     int height = yMax - yMin;                                                   \
@@ -3003,7 +5333,7 @@ static inline void FUNC_NAME(void)
     float hRcp = (height > 0.0f)? 1.0f/height : 0.0f;                           \
                                                                                 \
     /* Calculation of vertex gradients in X and Y */                            \
-    float tcDx[2], tcDy[2];                                                     \
+    float tcDx[2] = { 0 }, tcDy[2] = { 0 };                                     \
     if (ENABLE_TEXTURE) {                                                       \
         tcDx[0] = (v1->texcoord[0] - v0->texcoord[0])*wRcp;                     \
         tcDx[1] = (v1->texcoord[1] - v0->texcoord[1])*wRcp;                     \
@@ -3026,113 +5356,122 @@ static inline void FUNC_NAME(void)
     zDy = (v3->homogeneous[2] - v0->homogeneous[2])*hRcp;                       \
                                                                                 \
     /* Start of quad rasterization */                                           \
-    const sw_texture_t *tex;                                                    \
-    if (ENABLE_TEXTURE) tex = &RLSW.loadedTextures[RLSW.currentTexture];        \
+    const sw_texture_t *tex = NULL;                                             \
+    sw_texture_lod_t lod = { 0 };                                               \
+    if (ENABLE_TEXTURE) {                                                       \
+        tex = &RLSW.loadedTextures[RLSW.currentTexture];                        \
+        sw_texture_get_lod(&lod, tex, tcDx[0], tcDy[0], tcDx[1], tcDy[1]);      \
+    }                                                                           \
                                                                                 \
     void *cDstBase = RLSW.framebuffer.color;                                    \
     void *dDstBase = RLSW.framebuffer.depth;                                    \
     int wDst = RLSW.framebuffer.width;                                          \
                                                                                 \
-    float zScanline = v0->homogeneous[2];                                       \
-    float uScanline = v0->texcoord[0];                                          \
-    float vScanline = v0->texcoord[1];                                          \
+    /* Restrict the quad to the rasterization bounds */                         \
+    /* NOTE: Values are evaluated at each pixel distance from the quad origin, not stepped, */ \
+    /* so clipped quads (tiles, scissor) get the same values as unclipped ones */ \
+    int xOrigin = xMin, yOrigin = yMin;                                         \
+    if (xMin < RLSW.rasterMin[0]) xMin = RLSW.rasterMin[0];                     \
+    if (yMin < RLSW.rasterMin[1]) yMin = RLSW.rasterMin[1];                     \
+    if (xMax > RLSW.rasterMax[0]) xMax = RLSW.rasterMax[0];                     \
+    if (yMax > RLSW.rasterMax[1]) yMax = RLSW.rasterMax[1];                     \
+    if ((xMin >= xMax) || (yMin >= yMax)) return;                               \
                                                                                 \
-    float colorScanline[4] = {                                                  \
-        v0->color[0],                                                           \
-        v0->color[1],                                                           \
-        v0->color[2],                                                           \
-        v0->color[3]                                                            \
-    };                                                                          \
+    /* Reject the whole quad if hidden, record its depth writes otherwise */    \
+    float zFirst = v0->homogeneous[2] + zDy*(float)(yMin - yOrigin) + zDx*(float)(xMin - xOrigin); \
+    float zStepX = zDx*(xMax - xMin - 1), zStepY = zDy*(yMax - yMin - 1);       \
+    float zMin = zFirst + fminf(zStepX, 0.0f) + fminf(zStepY, 0.0f);            \
+    float zMax = zFirst + fmaxf(zStepX, 0.0f) + fmaxf(zStepY, 0.0f);            \
+    if (ENABLE_DEPTH_TEST && !sw_hiz_test(xMin, yMin, xMax, yMax, zMin, true)) return; \
+    sw_hiz_update(xMin, yMin, xMax, yMax, zMin, zMax, ENABLE_DEPTH_TEST);       \
                                                                                 \
     for (int y = yMin; y < yMax; y++)                                           \
     {                                                                           \
         void *cptr = sw_framebuffer_get_color_addr(cDstBase, y*wDst + xMin);    \
         void *dptr = sw_framebuffer_get_depth_addr(dDstBase, y*wDst + xMin);    \
                                                                                 \
-        float z = zScanline;                                                    \
-        float u = uScanline;                                                    \
-        float v = vScanline;                                                    \
+        /* Row values at the quad origin column */                              \
+        float yPosition = (float)(y - yOrigin);                                 \
+        float zRow = v0->homogeneous[2] + zDy*yPosition;                        \
+        float uRow = v0->texcoord[0] + tcDy[0]*yPosition;                       \
+        float vRow = v0->texcoord[1] + tcDy[1]*yPosition;                       \
                                                                                 \
-        float color[4] = {                                                      \
-            colorScanline[0],                                                   \
-            colorScanline[1],                                                   \
-            colorScanline[2],                                                   \
-            colorScanline[3]                                                    \
+        float colorRow[4] = {                                                   \
+            v0->color[0] + cDy[0]*yPosition,                                    \
+            v0->color[1] + cDy[1]*yPosition,                                    \
+            v0->color[2] + cDy[2]*yPosition,                                    \
+            v0->color[3] + cDy[3]*yPosition                                     \
         };                                                                      \
                                                                                 \
-        /* Scanline rasterization */                                            \
-        for (int x = xMin; x < xMax; x++)                                       \
+        /* Vectorized scanline rasterization, when available */                 \
+        if (SW_SIMD_WIDTH > 1)                                                  \
         {                                                                       \
-            /* Test and write depth */                                          \
-            if (ENABLE_DEPTH_TEST)                                              \
-            {                                                                   \
-                /* TODO: Implement different depth funcs? */                    \
-                float depth =  sw_framebuffer_read_depth(dptr);                 \
-                if (z > depth) goto discard;                                    \
-            }                                                                   \
-                                                                                \
-            sw_framebuffer_write_depth(dptr, z);                                \
-                                                                                \
-            /* Pixel color computation */                                       \
-            float srcColor[4] = {                                               \
-                color[0],                                                       \
-                color[1],                                                       \
-                color[2],                                                       \
-                color[3]                                                        \
+            sw_span_t span = {                                                  \
+                tex, zRow, 1.0f,                                                \
+                { colorRow[0], colorRow[1], colorRow[2], colorRow[3] },         \
+                uRow, vRow, zDx, 0.0f,                                          \
+                { cDx[0], cDx[1], cDx[2], cDx[3] },                             \
+                tcDx[0], tcDx[1], tcDy[0], tcDy[1], 0.0f, xMin - xOrigin        \
             };                                                                  \
-                                                                                \
-            if (ENABLE_TEXTURE)                                                 \
+            RLSW.pipeline.quadSpan(cptr, dptr, xMax - xMin, &span);             \
+        }                                                                       \
+        else                                                                    \
+        {                                                                       \
+            /* Scanline rasterization */                                        \
+            for (int x = xMin; x < xMax; x++)                                   \
             {                                                                   \
-                float texColor[4];                                              \
-                sw_texture_sample(texColor, tex, u, v, tcDx[0], tcDy[0], tcDx[1], tcDy[1]); \
-                srcColor[0] *= texColor[0];                                     \
-                srcColor[1] *= texColor[1];                                     \
-                srcColor[2] *= texColor[2];                                     \
-                srcColor[3] *= texColor[3];                                     \
-            }                                                                   \
+                float position = (float)(x - xOrigin);                          \
+                float z = zRow + zDx*position;                                  \
                                                                                 \
-            if (ENABLE_COLOR_BLEND)                                             \
-            {                                                                   \
-                float dstColor[4];                                              \
-                sw_framebuffer_read_color(dstColor, cptr);                      \
+                /* Test and write depth */                                      \
+                if (ENABLE_DEPTH_TEST)                                          \
+                {                                                               \
+                    /* TODO: Implement different depth funcs? */                \
+                    float depth =  sw_framebuffer_read_depth(dptr);             \
+                    if (z > depth) { SW_STATS_ADD(fragmentsDepthRejected, 1); goto discard; } \
+                }                                                               \
                                                                                 \
-                sw_blend_colors(dstColor, srcColor);                            \
-                dstColor[0] = sw_saturate(dstColor[0]);                         \
-                dstColor[1] = sw_saturate(dstColor[1]);                         \
-                dstColor[2] = sw_saturate(dstColor[2]);                         \
-                dstColor[3] = sw_saturate(dstColor[3]);                         \
+                sw_framebuffer_write_depth(dptr, z);                            \
+                SW_STATS_ADD(fragmentsShaded, 1);                               \
                                                                                 \
-                sw_framebuffer_write_color(cptr, dstColor);                     \
-            }                                                                   \
-            else sw_framebuffer_write_color(cptr, srcColor);                    \
+                /* Pixel color computation */                                   \
+                float srcColor[4] = {                                           \
+                    colorRow[0] + cDx[0]*position,                              \
+                    colorRow[1] + cDx[1]*position,                              \
+                    colorRow[2] + cDx[2]*position,                              \
+                    colorRow[3] + cDx[3]*position                               \
+                };                                                              \
                                                                                 \
-        discard:                                                                \
-            z += zDx;                                                           \
-            color[0] += cDx[0];                                                 \
-            color[1] += cDx[1];                                                 \
-            color[2] += cDx[2];                                                 \
-            color[3] += cDx[3];                                                 \
+                if (ENABLE_TEXTURE)                                             \
+                {                                                               \
+                    float texColor[4];                                          \
+                    sw_texture_sample_lod(texColor, &lod, uRow + tcDx[0]*position, vRow + tcDx[1]*position); \
+                    srcColor[0] *= texColor[0];                                 \
+                    srcColor[1] *= texColor[1];                                 \
+                    srcColor[2] *= texColor[2];                                 \
+                    srcColor[3] *= texColor[3];                                 \
+                }                                                               \
                                                                                 \
-            if (ENABLE_TEXTURE)                                                 \
-            {                                                                   \
-                u += tcDx[0];                                                   \
-                v += tcDx[1];                                                   \
-            }                                                                   \
+                if (ENABLE_COLOR_BLEND)                                         \
+                {                                                               \
+                    float dstColor[4];                                          \
+                    SW_STATS_ADD(fragmentsBlended, 1);                          \
+                    sw_framebuffer_read_color(dstColor, cptr);                  \
                                                                                 \
-            sw_framebuffer_inc_color_addr(&cptr);                               \
-            sw_framebuffer_inc_depth_addr(&dptr);                               \
-        }                                                                       \
+                    sw_blend_colors(dstColor, srcColor);                        \
+                    dstColor[0] = sw_saturate(dstColor[0]);                     \
+                    dstColor[1] = sw_saturate(dstColor[1]);                     \
+                    dstColor[2] = sw_saturate(dstColor[2]);                     \
+                    dstColor[3] = sw_saturate(dstColor[3]);                     \
                                                                                 \
-        zScanline += zDy;                                                       \
-        colorScanline[0] += cDy[0];                                             \
-        colorScanline[1] += cDy[1];                                             \
-        colorScanline[2] += cDy[2];                                             \
-        colorScanline[3] += cDy[3];                                             \
+                    sw_framebuffer_write_color(cptr, dstColor);                 \
+                }                                                               \
+                else sw_framebuffer_write_color(cptr, srcColor);                \
                                                                                 \
-        if (ENABLE_TEXTURE)                                                     \
-        {                                                                       \
-            uScanline += tcDy[0];                                               \
-            vScanline += tcDy[1];                                               \
+            discard:                                                            \
+                sw_framebuffer_inc_color_addr(&cptr);                           \
+                sw_framebuffer_inc_depth_addr(&dptr);                           \
+            }                                                                   \
         }                                                                       \
     }                                                                           \
 }
@@ -3146,53 +5485,200 @@ DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_BLEND, 1, 0, 1)
 DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_DEPTH_BLEND, 0, 1, 1)
 DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND, 1, 1, 1)
 
+// Blitter for screen-aligned sprites: flat quads with a constant color and texture coordinates
+// following the screen axes (DrawTexture(), DrawTextureRec(), font glyphs, tilemaps...)
+// Rows are copied or blended directly, texels are stepped in fixed point with nearest filtering,
+// without depth, color or perspective interpolation
+// NOTE: Returns false if the quad does not qualify, nothing has been drawn in that case
+static inline bool sw_quad_blit(const sw_vertex_t *vertices)
+{
+    const sw_vertex_t *sortedVerts[4];
+    sw_quad_sort_cw(sortedVerts, vertices);
+
+    const sw_vertex_t *v0 = sortedVerts[0];
+    const sw_vertex_t *v1 = sortedVerts[1];
+    const sw_vertex_t *v2 = sortedVerts[2];
+    const sw_vertex_t *v3 = sortedVerts[3];
+
+    // Texture coordinates must follow the screen axes, color and depth must be constant
+    if ((v1->texcoord[1] != v0->texcoord[1]) || (v3->texcoord[0] != v0->texcoord[0])) return false;
+    if ((v1->homogeneous[2] != v0->homogeneous[2]) || (v3->homogeneous[2] != v0->homogeneous[2])) return false;
+    for (int i = 1; i < 4; i++)
+    {
+        const float *color = sortedVerts[i]->color;
+        if ((color[0] != v0->color[0]) || (color[1] != v0->color[1]) ||
+            (color[2] != v0->color[2]) || (color[3] != v0->color[3])) return false;
+    }
+
+    int xMin = sw_floori(v0->screen[0] + 0.5f);
+    int yMin = sw_floori(v0->screen[1] + 0.5f);
+    int xMax = sw_floori(v2->screen[0] + 0.5f);
+    int yMax = sw_floori(v2->screen[1] + 0.5f);
+
+    int width = xMax - xMin;
+    int height = yMax - yMin;
+
+    if ((width <= 0) || (height <= 0)) return false;
+
+    double duDx = (double)(v1->texcoord[0] - v0->texcoord[0])/width;
+    double dvDy = (double)(v3->texcoord[1] - v0->texcoord[1])/height;
+
+    // Only a single level sampled with nearest filtering can be stepped in texels
+    const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];
+    sw_texture_lod_t lod = { 0 };
+    sw_texture_get_lod(&lod, tex, (float)duDx, 0.0f, 0.0f, (float)dvDy);
+    if ((lod.nextLevel != NULL) || (lod.filter != SW_NEAREST)) return false;
+
+    tex = lod.level;
+
+    // Restrict the quad to the rasterization bounds
+    int xOrigin = xMin, yOrigin = yMin;
+    if (xMin < RLSW.rasterMin[0]) xMin = RLSW.rasterMin[0];
+    if (yMin < RLSW.rasterMin[1]) yMin = RLSW.rasterMin[1];
+    if (xMax > RLSW.rasterMax[0]) xMax = RLSW.rasterMax[0];
+    if (yMax > RLSW.rasterMax[1]) yMax = RLSW.rasterMax[1];
+    if ((xMin >= xMax) || (yMin >= yMax)) return true;
+
+    float z = v0->homogeneous[2];
+    sw_hiz_update(xMin, yMin, xMax, yMax, z, z, false);
+
+    // Texel coordinates in 32.32 fixed point, wrapping is only needed if the row leaves the texture
+    // NOTE: Biased by 2^-16 texel so the rounded steps do not accumulate below exact texel edges (integer scales),
+    // stepped from the quad origin in integers, so clipped quads (tiles, scissor) get the same texels
+    int count = xMax - xMin;
+    int64_t sStep = sw_fixed32(duDx*tex->width);
+    int64_t sFirst = sw_fixed32((double)v0->texcoord[0]*tex->width) + 65536 + sStep*(xMin - xOrigin);
+    int64_t tStep = sw_fixed32(dvDy*tex->height);
+    int64_t tFirst = sw_fixed32((double)v0->texcoord[1]*tex->height) + 65536 + tStep*(yMin - yOrigin);
+    int xFirst = (int)(sFirst >> 32);
+    int xLast = (int)((sFirst + sStep*(count - 1)) >> 32);
+    bool wrapX = (xFirst < 0) || (xFirst > tex->wMinus1) || (xLast < 0) || (xLast > tex->wMinus1);
+
+    const float *tint = v0->color;
+    bool blend = ((RLSW.stateFlags & SW_STATE_BLEND) != 0);
+    bool alphaBlend = blend && (RLSW.srcFactor == SW_SRC_ALPHA) && (RLSW.dstFactor == SW_ONE_MINUS_SRC_ALPHA);
+
+    int64_t t = tFirst;
+    for (int y = yMin; y < yMax; y++, t += tStep)
+    {
+        int ty = sw_texture_wrap((int)(t >> 32), tex->height, tex->hMinus1, tex->tWrap, tex->isPOT);
+
+        void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, y*RLSW.framebuffer.width + xMin);
+        void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, y*RLSW.framebuffer.width + xMin);
+
+        int64_t s = sFirst;
+        for (int x = 0; x < count; x++, s += sStep)
+        {
+            int tx = (int)(s >> 32);
+            if (wrapX) tx = sw_texture_wrap(tx, tex->width, tex->wMinus1, tex->sWrap, tex->isPOT);
+
+            float srcColor[4];
+            sw_get_pixel(srcColor, tex->pixels.cptr, sw_texture_texel_offset(tex, tx, ty), tex->format);
+            srcColor[0] *= tint[0];
+            srcColor[1] *= tint[1];
+            srcColor[2] *= tint[2];
+            srcColor[3] *= tint[3];
+
+            sw_framebuffer_write_depth(dptr, z);
+
+            if (alphaBlend && (srcColor[3] < 1.0f))
+            {
+                // Transparent texels (most of a glyph) leave the color buffer untouched
+                float alpha = srcColor[3];
+                if (alpha > 0.0f)
+                {
+                    float dstColor[4];
+                    sw_framebuffer_read_color(dstColor, cptr);
+                    dstColor[0] = sw_saturate(srcColor[0]*alpha + dstColor[0]*(1.0f - alpha));
+                    dstColor[1] = sw_saturate(srcColor[1]*alpha + dstColor[1]*(1.0f - alpha));
+                    dstColor[2] = sw_saturate(srcColor[2]*alpha + dstColor[2]*(1.0f - alpha));
+                    dstColor[3] = sw_saturate(alpha*alpha + dstColor[3]*(1.0f - alpha));
+                    sw_framebuffer_write_color(cptr, dstColor);
+                }
+            }
+            else if (blend && !alphaBlend)
+            {
+                float dstColor[4];
+                sw_framebuffer_read_color(dstColor, cptr);
+                sw_blend_colors(dstColor, srcColor);
+                dstColor[0] = sw_saturate(dstColor[0]);
+                dstColor[1] = sw_saturate(dstColor[1]);
+                dstColor[2] = sw_saturate(dstColor[2]);
+                dstColor[3] = sw_saturate(dstColor[3]);
+                sw_framebuffer_write_color(cptr, dstColor);
+            }
+            else sw_framebuffer_write_color(cptr, srcColor);
+
+            sw_framebuffer_inc_color_addr(&cptr);
+            sw_framebuffer_inc_depth_addr(&dptr);
+        }
+    }
+
+    SW_STATS_ADD(texelsFetched, count*(yMax - yMin));
+    SW_STATS_ADD(fragmentsShaded, count*(yMax - yMin));
+    if (blend) SW_STATS_ADD(fragmentsBlended, count*(yMax - yMin));
+
+    return true;
+}
+
+static inline void sw_quad_axis_aligned_rasterize(const sw_vertex_t *vertices)
+{
+    int bounds[4];
+    if (!sw_raster_bounds_restrict(bounds))
+    {
+        sw_raster_bounds_restore(bounds);
+        return;
+    }
+
+    // Textured sprites without depth test go through the blitter when possible
+    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D) && !(RLSW.stateFlags & SW_STATE_DEPTH_TEST) && sw_quad_blit(vertices))
+    {
+        sw_raster_bounds_restore(bounds);
+        return;
+    }
+
+    sw_pipeline_update();
+
+    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_DEPTH_BLEND(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_BLEND(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_TEX_DEPTH(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_quad_raster_axis_aligned_BLEND(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_DEPTH(vertices);
+    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) sw_quad_raster_axis_aligned_TEX(vertices);
+    else sw_quad_raster_axis_aligned(vertices);
+
+    sw_raster_bounds_restore(bounds);
+}
+
 static inline void sw_quad_render(void)
 {
     if (RLSW.stateFlags & SW_STATE_CULL_FACE)
     {
-        if (!sw_quad_face_culling()) return;
+        if (!sw_quad_face_culling()) { SW_STATS_ADD(primitivesCulled, 1); return; }
     }
 
     sw_quad_clip_and_project();
 
-    if (RLSW.vertexCounter < 3) return;
+    if (RLSW.vertexCounter < 3) { SW_STATS_ADD(primitivesClipped, 1); return; }
+
+    sw_framebuffer_mark_vertices(RLSW.vertexBuffer, RLSW.vertexCounter, 1.0f);
+    if (sw_edge_list_is_active()) sw_edge_list_record(RLSW.vertexBuffer, RLSW.vertexCounter);
 
     if (RLSW.vertexCounter == 4 && sw_quad_is_axis_aligned())
     {
-        if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_DEPTH_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_TEX_DEPTH();
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_quad_raster_axis_aligned_BLEND();
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_DEPTH();
-        else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) sw_quad_raster_axis_aligned_TEX();
-        else sw_quad_raster_axis_aligned();
+    #if SW_ENABLE_BINNING
+        if (sw_bin_push(SW_BIN_CMD_QUAD, RLSW.vertexBuffer, 4, 0)) return;
+    #endif
+        sw_quad_axis_aligned_rasterize(RLSW.vertexBuffer);
         return;
     }
 
-    #define TRIANGLE_RASTER(RASTER_FUNC)                        \
-    {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
-        {                                                       \
-            RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
-                &RLSW.loadedTextures[RLSW.currentTexture]       \
-            );                                                  \
-        }                                                       \
-    }
-
-    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH)
-    else if (SW_STATE_CHECK(SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_BLEND)
-    else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH)
-    else if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D)) TRIANGLE_RASTER(sw_triangle_raster_TEX)
-    else TRIANGLE_RASTER(sw_triangle_raster)
+#if SW_ENABLE_BINNING
+    if (sw_bin_push(SW_BIN_CMD_POLYGON, RLSW.vertexBuffer, RLSW.vertexCounter, 0)) return;
+#endif
 
-    #undef TRIANGLE_RASTER
+    sw_triangle_fan_rasterize(RLSW.vertexBuffer, RLSW.vertexCounter);
 }
 
 // Line rendering logic
@@ -3354,27 +5840,36 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
     void *cBuffer = RLSW.framebuffer.color;                             \
     void *dBuffer = RLSW.framebuffer.depth;                             \
                                                                         \
+    const int xMin = RLSW.rasterMin[0], xMax = RLSW.rasterMax[0];       \
+    const int yMin = RLSW.rasterMin[1], yMax = RLSW.rasterMax[1];       \
+                                                                        \
     int j = 0;                                                          \
     if (yLonger)                                                        \
     {                                                                   \
         for (int i = 0; i != longLen; i += sgnInc)                      \
         {                                                               \
-            int offset = (y1 + i)*fbWidth + (x1 + (j >> 16));           \
+            int x = x1 + (j >> 16), y = y1 + i;                         \
+            if ((x < xMin) || (x >= xMax) || (y < yMin) || (y >= yMax)) goto discardA; \
+                                                                        \
+            int offset = y*fbWidth + x;                                 \
             void *dptr = sw_framebuffer_get_depth_addr(dBuffer, offset); \
                                                                         \
             if (ENABLE_DEPTH_TEST)                                      \
             {                                                           \
                 float depth = sw_framebuffer_read_depth(dptr);          \
-                if (z > depth) goto discardA;                           \
+                if (z > depth) { SW_STATS_ADD(fragmentsDepthRejected, 1); goto discardA; } \
             }                                                           \
                                                                         \
             sw_framebuffer_write_depth(dptr, z);                        \
+            SW_STATS_ADD(fragmentsShaded, 1);                           \
+            sw_hiz_update(x, y, x + 1, y + 1, z, z, ENABLE_DEPTH_TEST); \
                                                                         \
             void *cptr = sw_framebuffer_get_color_addr(cBuffer, offset); \
                                                                         \
             if (ENABLE_COLOR_BLEND)                                     \
             {                                                           \
                 float dstColor[4];                                      \
+                SW_STATS_ADD(fragmentsBlended, 1);                      \
                 sw_framebuffer_read_color(dstColor, cptr);              \
                                                                         \
                 sw_blend_colors(dstColor, color);                       \
@@ -3395,22 +5890,28 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
     {                                                                   \
         for (int i = 0; i != longLen; i += sgnInc)                      \
         {                                                               \
-            int offset = (y1 + (j >> 16))*fbWidth + (x1 + i);           \
+            int x = x1 + i, y = y1 + (j >> 16);                         \
+            if ((x < xMin) || (x >= xMax) || (y < yMin) || (y >= yMax)) goto discardB; \
+                                                                        \
+            int offset = y*fbWidth + x;                                 \
             void *dptr = sw_framebuffer_get_depth_addr(dBuffer, offset); \
                                                                         \
             if (ENABLE_DEPTH_TEST)                                      \
             {                                                           \
                 float depth = sw_framebuffer_read_depth(dptr);          \
-                if (z > depth) goto discardB;                           \
+                if (z > depth) { SW_STATS_ADD(fragmentsDepthRejected, 1); goto discardB; } \
             }                                                           \
                                                                         \
             sw_framebuffer_write_depth(dptr, z);                        \
+            SW_STATS_ADD(fragmentsShaded, 1);                           \
+            sw_hiz_update(x, y, x + 1, y + 1, z, z, ENABLE_DEPTH_TEST); \
                                                                         \
             void *cptr = sw_framebuffer_get_color_addr(cBuffer, offset); \
                                                                         \
             if (ENABLE_COLOR_BLEND)                                     \
             {                                                           \
                 float dstColor[4];                                      \
+                SW_STATS_ADD(fragmentsBlended, 1);                      \
                 sw_framebuffer_read_color(dstColor, cptr);              \
                                                                         \
                 sw_blend_colors(dstColor, color);                       \
@@ -3488,26 +5989,121 @@ DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_DEPTH, sw_line_raster_DEPTH)
 DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_BLEND, sw_line_raster_BLEND)
 DEFINE_LINE_THICK_RASTER(sw_line_thick_raster_DEPTH_BLEND, sw_line_raster_DEPTH_BLEND)
 
-static inline void sw_line_render(sw_vertex_t *vertices)
+// Anti-aliased thin line, coverage split between the two pixels closest to the line along its minor axis
+// NOTE: Used with SW_MULTISAMPLE, coverage is applied as a blend toward the line color
+static inline void sw_line_raster_smooth(const sw_vertex_t *v0, const sw_vertex_t *v1)
 {
-    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
+    int major = (fabsf(v1->screen[0] - v0->screen[0]) >= fabsf(v1->screen[1] - v0->screen[1]))? 0 : 1;
+    int minor = 1 - major;
+
+    if (v1->screen[major] < v0->screen[major]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; }
+
+    float length = v1->screen[major] - v0->screen[major];
+    if (length < 1e-6f) return;
+
+    const float lengthRcp = 1.0f/length;
+    const float slope = (v1->screen[minor] - v0->screen[minor])*lengthRcp;
+
+    int start = sw_floori(v0->screen[major] + 0.5f);
+    int end = sw_floori(v1->screen[major] + 0.5f);
+    if (start < RLSW.rasterMin[major]) start = RLSW.rasterMin[major];
+    if (end > RLSW.rasterMax[major]) end = RLSW.rasterMax[major];
+
+    const bool depthTest = ((RLSW.stateFlags & SW_STATE_DEPTH_TEST) != 0);
+    const bool blend = ((RLSW.stateFlags & SW_STATE_BLEND) != 0);
+    const int stride[2] = { 1, RLSW.framebuffer.width };
+
+    for (int i = start; i < end; i++)
+    {
+        float d = (float)i + 0.5f - v0->screen[major];
+        float t = d*lengthRcp;
+        float c = v0->screen[minor] + slope*d - 0.5f;
+        float z = v0->homogeneous[2] + (v1->homogeneous[2] - v0->homogeneous[2])*t;
+
+        float color[4];
+        for (int k = 0; k < 4; k++) color[k] = v0->color[k] + (v1->color[k] - v0->color[k])*t;
+
+        // The line covers the pixel below its center by (1 - f) and the next one by f
+        int j = sw_floori(c);
+        float f = c - (float)j;
+
+        for (int n = 0; n < 2; n++)
+        {
+            int jn = j + n;
+            float coverage = (n == 0)? 1.0f - f : f;
+            if ((coverage < 1.0f/512.0f) || (jn < RLSW.rasterMin[minor]) || (jn >= RLSW.rasterMax[minor])) continue;
+
+            int offset = i*stride[major] + jn*stride[minor];
+            void *dptr = sw_framebuffer_get_depth_addr(RLSW.framebuffer.depth, offset);
+
+            if (depthTest && (z > sw_framebuffer_read_depth(dptr))) { SW_STATS_ADD(fragmentsDepthRejected, 1); continue; }
+
+            // Only the pixel mostly covered by the line occludes what is drawn after it
+            if (coverage >= 0.5f)
+            {
+                int x = (major == 0)? i : jn, y = (major == 0)? jn : i;
+                sw_framebuffer_write_depth(dptr, z);
+                sw_hiz_update(x, y, x + 1, y + 1, z, z, depthTest);
+            }
+
+            SW_STATS_ADD(fragmentsShaded, 1);
+
+            void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, offset);
+
+            float dstColor[4], srcColor[4] = { color[0], color[1], color[2], color[3] };
+            sw_framebuffer_read_color(dstColor, cptr);
+
+            if (blend)
+            {
+                SW_STATS_ADD(fragmentsBlended, 1);
+                float blended[4] = { dstColor[0], dstColor[1], dstColor[2], dstColor[3] };
+                sw_blend_colors(blended, srcColor);
+                for (int k = 0; k < 4; k++) srcColor[k] = blended[k];
+            }
+
+            for (int k = 0; k < 4; k++) dstColor[k] += (srcColor[k] - dstColor[k])*coverage + 0.5f/255.0f;
+            sw_framebuffer_write_color(cptr, dstColor);
+        }
+    }
+}
+
+static inline void sw_line_rasterize(const sw_vertex_t *v0, const sw_vertex_t *v1)
+{
+    if (sw_edge_list_is_active() && (RLSW.lineWidth < 2.0f))
+    {
+        sw_line_raster_smooth(v0, v1);
+        return;
+    }
 
     if (RLSW.lineWidth >= 2.0f)
     {
-        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_thick_raster_DEPTH_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_thick_raster_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_thick_raster_DEPTH(&vertices[0], &vertices[1]);
-        else sw_line_thick_raster(&vertices[0], &vertices[1]);
+        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_thick_raster_DEPTH_BLEND(v0, v1);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_thick_raster_BLEND(v0, v1);
+        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_thick_raster_DEPTH(v0, v1);
+        else sw_line_thick_raster(v0, v1);
     }
     else
     {
-        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_raster_DEPTH_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_raster_BLEND(&vertices[0], &vertices[1]);
-        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_raster_DEPTH(&vertices[0], &vertices[1]);
-        else sw_line_raster(&vertices[0], &vertices[1]);
+        if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_raster_DEPTH_BLEND(v0, v1);
+        else if (SW_STATE_CHECK(SW_STATE_BLEND)) sw_line_raster_BLEND(v0, v1);
+        else if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) sw_line_raster_DEPTH(v0, v1);
+        else sw_line_raster(v0, v1);
     }
 }
 
+static inline void sw_line_render(sw_vertex_t *vertices)
+{
+    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) { SW_STATS_ADD(primitivesClipped, 1); return; }
+
+    sw_framebuffer_mark_vertices(vertices, 2, 1.0f + RLSW.lineWidth);
+
+#if SW_ENABLE_BINNING
+    if (sw_bin_push(SW_BIN_CMD_LINE, vertices, 2, 0)) return;
+#endif
+
+    sw_line_rasterize(&vertices[0], &vertices[1]);
+}
+
 // Point rendering logic
 
 static inline bool sw_point_clip_and_project(sw_vertex_t *v)
@@ -3549,6 +6145,9 @@ static inline bool sw_point_clip_and_project(sw_vertex_t *v)
 #define DEFINE_POINT_RASTER(FUNC_NAME, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND, CHECK_BOUNDS) \
 static inline void FUNC_NAME(int x, int y, float z, const float color[4])   \
 {                                                                           \
+    if (x < RLSW.rasterMin[0] || x >= RLSW.rasterMax[0]) return;            \
+    if (y < RLSW.rasterMin[1] || y >= RLSW.rasterMax[1]) return;            \
+                                                                            \
     if (CHECK_BOUNDS == 1)                                                  \
     {                                                                       \
         if (x < RLSW.vpMin[0] || x >= RLSW.vpMax[0]) return;                \
@@ -3567,16 +6166,19 @@ static inline void FUNC_NAME(int x, int y, float z, const float color[4])   \
     if (ENABLE_DEPTH_TEST)                                                  \
     {                                                                       \
         float depth = sw_framebuffer_read_depth(dptr);                      \
-        if (z > depth) return;                                              \
+        if (z > depth) { SW_STATS_ADD(fragmentsDepthRejected, 1); return; } \
     }                                                                       \
                                                                             \
     sw_framebuffer_write_depth(dptr, z);                                    \
+    SW_STATS_ADD(fragmentsShaded, 1);                                       \
+    sw_hiz_update(x, y, x + 1, y + 1, z, z, ENABLE_DEPTH_TEST);             \
                                                                             \
     void *cptr = sw_framebuffer_get_color_addr(RLSW.framebuffer.color, offset); \
                                                                             \
     if (ENABLE_COLOR_BLEND)                                                 \
     {                                                                       \
         float dstColor[4];                                                  \
+        SW_STATS_ADD(fragmentsBlended, 1);                                  \
         sw_framebuffer_read_color(dstColor, cptr);                          \
                                                                             \
         sw_blend_colors(dstColor, color);                                   \
@@ -3586,7 +6188,7 @@ static inline void FUNC_NAME(int x, int y, float z, const float color[4])   \
 }
 
 #define DEFINE_POINT_THICK_RASTER(FUNC_NAME, RASTER_FUNC)                   \
-static inline void FUNC_NAME(sw_vertex_t *v)                                \
+static inline void FUNC_NAME(const sw_vertex_t *v)                          \
 {                                                                           \
     int cx = v->screen[0];                                                  \
     int cy = v->screen[1];                                                  \
@@ -3645,10 +6247,8 @@ DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_SCISSOR, sw_point_raster_D
 DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_BLEND_SCISSOR, sw_point_raster_BLEND_CHECK_SCISSOR)
 DEFINE_POINT_THICK_RASTER(sw_point_thick_raster_DEPTH_BLEND_SCISSOR, sw_point_raster_DEPTH_BLEND_CHECK_SCISSOR)
 
-static inline void sw_point_render(sw_vertex_t *v)
+static inline void sw_point_rasterize(const sw_vertex_t *v)
 {
-    if (!sw_point_clip_and_project(v)) return;
-
     if (RLSW.pointRadius >= 1.0f)
     {
         if (SW_STATE_CHECK(SW_STATE_SCISSOR_TEST))
@@ -3675,127 +6275,937 @@ static inline void sw_point_render(sw_vertex_t *v)
     }
 }
 
-// Polygon modes mendering logic
-
-static inline void sw_poly_point_render(void)
+static inline void sw_point_render(sw_vertex_t *v)
 {
-    for (int i = 0; i < RLSW.vertexCounter; i++) sw_point_render(&RLSW.vertexBuffer[i]);
-}
+    if (!sw_point_clip_and_project(v)) { SW_STATS_ADD(primitivesClipped, 1); return; }
 
-static inline void sw_poly_line_render(void)
-{
-    const sw_vertex_t *vertices = RLSW.vertexBuffer;
-    int cm1 = RLSW.vertexCounter - 1;
+    sw_framebuffer_mark_vertices(v, 1, 1.0f + RLSW.pointRadius);
 
-    for (int i = 0; i < cm1; i++) sw_line_render((sw_vertex_t[2]){ vertices[i], vertices[i + 1] });
+#if SW_ENABLE_BINNING
+    if (sw_bin_push(SW_BIN_CMD_POINT, v, 1, 0)) return;
+#endif
 
-    sw_line_render((sw_vertex_t[2]){ vertices[cm1], vertices[0] });
+    sw_point_rasterize(v);
+}
+
+#if SW_ENABLE_BINNING || SW_ENABLE_ASYNC_PRESENT || SW_ENABLE_CONTEXTS
+// Threading helpers
+
+#if defined(_MSC_VER)
+// NOTE: Declared locally to avoid including windows.h, ALL_PROCESSOR_GROUPS = 0xffff
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+
+static inline void sw_mutex_init(sw_mutex_t *mutex) { mtx_init(mutex, mtx_plain); }
+static inline void sw_mutex_destroy(sw_mutex_t *mutex) { mtx_destroy(mutex); }
+static inline void sw_mutex_lock(sw_mutex_t *mutex) { mtx_lock(mutex); }
+static inline void sw_mutex_unlock(sw_mutex_t *mutex) { mtx_unlock(mutex); }
+static inline void sw_cond_init(sw_cond_t *cond) { cnd_init(cond); }
+static inline void sw_cond_destroy(sw_cond_t *cond) { cnd_destroy(cond); }
+static inline void sw_cond_wait(sw_cond_t *cond, sw_mutex_t *mutex) { cnd_wait(cond, mutex); }
+static inline void sw_cond_signal(sw_cond_t *cond) { cnd_signal(cond); }
+static inline void sw_cond_broadcast(sw_cond_t *cond) { cnd_broadcast(cond); }
+static inline int sw_get_processor_count(void) { unsigned long count = GetActiveProcessorCount(0xffff); return (count > 0)? (int)count : 4; }
+#else
+static inline void sw_mutex_init(sw_mutex_t *mutex) { pthread_mutex_init(mutex, NULL); }
+static inline void sw_mutex_destroy(sw_mutex_t *mutex) { pthread_mutex_destroy(mutex); }
+static inline void sw_mutex_lock(sw_mutex_t *mutex) { pthread_mutex_lock(mutex); }
+static inline void sw_mutex_unlock(sw_mutex_t *mutex) { pthread_mutex_unlock(mutex); }
+static inline void sw_cond_init(sw_cond_t *cond) { pthread_cond_init(cond, NULL); }
+static inline void sw_cond_destroy(sw_cond_t *cond) { pthread_cond_destroy(cond); }
+static inline void sw_cond_wait(sw_cond_t *cond, sw_mutex_t *mutex) { pthread_cond_wait(cond, mutex); }
+static inline void sw_cond_signal(sw_cond_t *cond) { pthread_cond_signal(cond); }
+static inline void sw_cond_broadcast(sw_cond_t *cond) { pthread_cond_broadcast(cond); }
+static inline int sw_get_processor_count(void) { long count = sysconf(_SC_NPROCESSORS_ONLN); return (count > 0)? (int)count : 4; }
+#endif
+#endif // SW_ENABLE_BINNING || SW_ENABLE_ASYNC_PRESENT || SW_ENABLE_CONTEXTS
+
+#if SW_ENABLE_BINNING
+// Tile binning rasterization logic
+
+static inline void sw_bin_state_apply(const sw_bin_state_t *state)
+{
+    RLSW.stateFlags = state->stateFlags;
+    RLSW.currentTexture = state->currentTexture;
+    RLSW.srcFactor = state->srcFactor;
+    RLSW.dstFactor = state->dstFactor;
+    RLSW.srcFactorFunc = state->srcFactorFunc;
+    RLSW.dstFactorFunc = state->dstFactorFunc;
+    RLSW.pointRadius = state->pointRadius;
+    RLSW.lineWidth = state->lineWidth;
+    for (int i = 0; i < 2; i++)
+    {
+        RLSW.vpCenter[i] = state->vpCenter[i];
+        RLSW.vpHalfSize[i] = state->vpHalfSize[i];
+        RLSW.vpMin[i] = state->vpMin[i];
+        RLSW.vpMax[i] = state->vpMax[i];
+        RLSW.scMin[i] = state->scMin[i];
+        RLSW.scMax[i] = state->scMax[i];
+    }
+    for (int i = 0; i < 4; i++) RLSW.clearColor[i] = state->clearColor[i];
+    RLSW.clearDepth = state->clearDepth;
 }
 
-static inline void sw_poly_fill_render(void)
+static inline void sw_bin_clear_tile(uint32_t bitmask)
 {
-    switch (RLSW.drawMode)
+    // NOTE: Fill functions honor the scissor rectangle (inclusive bounds),
+    // it is used here to restrict the clear to the tile area
+    int min[2] = { RLSW.rasterMin[0], RLSW.rasterMin[1] };
+    int max[2] = { RLSW.rasterMax[0] - 1, RLSW.rasterMax[1] - 1 };
+
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
     {
-        case SW_POINTS: sw_point_render(&RLSW.vertexBuffer[0]); break;
-        case SW_LINES: sw_line_render(RLSW.vertexBuffer); break;
-        case SW_TRIANGLES: sw_triangle_render(); break;
-        case SW_QUADS: sw_quad_render(); break;
+        for (int i = 0; i < 2; i++)
+        {
+            if (RLSW.scMin[i] > min[i]) min[i] = RLSW.scMin[i];
+            if (RLSW.scMax[i] < max[i]) max[i] = RLSW.scMax[i];
+        }
     }
-}
 
-// Validity check helper functions
+    if ((min[0] > max[0]) || (min[1] > max[1])) return;
 
-static inline bool sw_is_texture_valid(uint32_t id)
-{
-    bool valid = true;
+    RLSW.scMin[0] = min[0], RLSW.scMin[1] = min[1];
+    RLSW.scMax[0] = max[0], RLSW.scMax[1] = max[1];
+    RLSW.stateFlags |= SW_STATE_SCISSOR_TEST;
 
-    if (id == 0) valid = false;
-    else if (id >= SW_MAX_TEXTURES) valid = false;
-    else if (RLSW.loadedTextures[id].pixels.cptr == 0) valid = false;
+    if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT))
+    {
+        sw_framebuffer_fill(RLSW.framebuffer.color, RLSW.framebuffer.depth, 0, RLSW.clearColor, RLSW.clearDepth);
+    }
+    else if (bitmask & (SW_COLOR_BUFFER_BIT))
+    {
+        sw_framebuffer_fill_color(RLSW.framebuffer.color, 0, RLSW.clearColor);
+    }
+    else if (bitmask & SW_DEPTH_BUFFER_BIT)
+    {
+        sw_framebuffer_fill_depth(RLSW.framebuffer.depth, 0, RLSW.clearDepth);
+    }
 
-    return true;
+    if (bitmask & SW_DEPTH_BUFFER_BIT) sw_hiz_clear();
 }
 
-static inline bool sw_is_texture_filter_valid(int filter)
+static void sw_bin_rasterize_tile(int tile)
 {
-    return (filter == SW_NEAREST || filter == SW_LINEAR);
-}
+    const sw_binner_t *binner = &RLSW_BINNER;
+    const sw_bin_t *bin = &binner->bins[tile];
 
-static inline bool sw_is_texture_wrap_valid(int wrap)
-{
-    return (wrap == SW_REPEAT || wrap == SW_CLAMP);
-}
+    int tx = tile%binner->tilesX;
+    int ty = tile/binner->tilesX;
 
-static inline bool sw_is_draw_mode_valid(int mode)
-{
-    bool result = false;
+    RLSW.rasterMin[0] = tx*SW_BINNING_TILE_SIZE;
+    RLSW.rasterMin[1] = ty*SW_BINNING_TILE_SIZE;
+    RLSW.rasterMax[0] = RLSW.rasterMin[0] + SW_BINNING_TILE_SIZE;
+    RLSW.rasterMax[1] = RLSW.rasterMin[1] + SW_BINNING_TILE_SIZE;
+    if (RLSW.rasterMax[0] > RLSW.framebuffer.width) RLSW.rasterMax[0] = RLSW.framebuffer.width;
+    if (RLSW.rasterMax[1] > RLSW.framebuffer.height) RLSW.rasterMax[1] = RLSW.framebuffer.height;
 
-    switch (mode)
+    int currentState = -1;
+
+    for (int i = 0; i < bin->count; i++)
     {
-        case SW_POINTS:
-        case SW_LINES:
-        case SW_TRIANGLES:
-        case SW_QUADS: result = true; break;
-        default: break;
-    }
+        const sw_bin_cmd_t *cmd = &binner->commands[bin->commands[i]];
+        const sw_vertex_t *vertices = &binner->vertices[cmd->firstVertex];
 
-    return result;
+        if (cmd->stateIndex != currentState)
+        {
+            sw_bin_state_apply(&binner->states[cmd->stateIndex]);
+            currentState = cmd->stateIndex;
+        }
+
+        switch (cmd->type)
+        {
+            case SW_BIN_CMD_CLEAR: sw_bin_clear_tile(cmd->clearMask); currentState = -1; break;
+            case SW_BIN_CMD_POLYGON: sw_triangle_fan_rasterize(vertices, cmd->vertexCount); break;
+            case SW_BIN_CMD_QUAD: sw_quad_axis_aligned_rasterize(vertices); break;
+            case SW_BIN_CMD_LINE: sw_line_rasterize(&vertices[0], &vertices[1]); break;
+            case SW_BIN_CMD_POINT: sw_point_rasterize(&vertices[0]); break;
+            default: break;
+        }
+    }
 }
 
-static inline bool sw_is_poly_mode_valid(int mode)
+static void sw_bin_process_tiles(void)
 {
-    bool result = false;
+    sw_binner_t *binner = &RLSW_BINNER;
+    int tileCount = binner->tilesX*binner->tilesY;
 
-    switch (mode)
+    while (true)
     {
-        case SW_POINT:
-        case SW_LINE:
-        case SW_FILL: result = true; break;
-        default: break;
-    }
+        sw_mutex_lock(&binner->mutex);
+        int tile = binner->nextTile++;
+        sw_mutex_unlock(&binner->mutex);
 
-    return result;
+        if (tile >= tileCount) break;
+        if (binner->bins[tile].count > 0) sw_bin_rasterize_tile(tile);
+    }
 }
 
-static inline bool sw_is_face_valid(int face)
+static void sw_bin_worker_main(sw_bin_worker_t *worker)
 {
-    return (face == SW_FRONT || face == SW_BACK);
-}
+    sw_binner_t *binner = worker->binner;
+    uint32_t generation = 0;
 
-static inline bool sw_is_blend_src_factor_valid(int blend)
-{
-    bool result = false;
+    swCurrentContext = &worker->context;
 
-    switch (blend)
+    while (true)
     {
-        case SW_ZERO:
-        case SW_ONE:
-        case SW_SRC_COLOR:
-        case SW_ONE_MINUS_SRC_COLOR:
-        case SW_SRC_ALPHA:
-        case SW_ONE_MINUS_SRC_ALPHA:
-        case SW_DST_ALPHA:
-        case SW_ONE_MINUS_DST_ALPHA:
-        case SW_DST_COLOR:
-        case SW_ONE_MINUS_DST_COLOR:
-        case SW_SRC_ALPHA_SATURATE: result = true; break;
-        default: break;
-    }
+        sw_mutex_lock(&binner->mutex);
+        while (!binner->quit && (binner->generation == generation)) sw_cond_wait(&binner->startCond, &binner->mutex);
+        if (binner->quit)
+        {
+            sw_mutex_unlock(&binner->mutex);
+            break;
+        }
+        generation = binner->generation;
+        sw_mutex_unlock(&binner->mutex);
 
-    return result;
+        sw_bin_process_tiles();
+
+        sw_mutex_lock(&binner->mutex);
+        if (--binner->pendingWorkers == 0) sw_cond_signal(&binner->doneCond);
+        sw_mutex_unlock(&binner->mutex);
+    }
 }
 
-static inline bool sw_is_blend_dst_factor_valid(int blend)
+#if defined(_MSC_VER)
+static int sw_bin_worker_entry(void *arg) { sw_bin_worker_main((sw_bin_worker_t *)arg); return 0; }
+#else
+static void *sw_bin_worker_entry(void *arg) { sw_bin_worker_main((sw_bin_worker_t *)arg); return NULL; }
+#endif
+
+static void sw_bin_flush(void)
 {
-    bool result = false;
+    sw_binner_t *binner = &RLSW_BINNER;
 
-    switch (blend)
+    if (binner->commandCount == 0) return;
+
+    SW_STATS_TIMER_BEGIN();
+
+    // Worker contexts start as a copy of the recording context,
+    // they are only used to rasterize the recorded commands
+    for (int i = 0; i < binner->threadCount; i++)
     {
-        case SW_ZERO:
-        case SW_ONE:
-        case SW_SRC_COLOR:
-        case SW_ONE_MINUS_SRC_COLOR:
-        case SW_SRC_ALPHA:
+        binner->workers[i].context = RLSW;
+    #if SW_ENABLE_STATS
+        binner->workers[i].context.stats = (SWstats) { 0 };
+    #endif
+    }
+
+    sw_mutex_lock(&binner->mutex);
+    binner->nextTile = 0;
+    binner->pendingWorkers = binner->threadCount - 1;
+    binner->generation++;
+    sw_cond_broadcast(&binner->startCond);
+    sw_mutex_unlock(&binner->mutex);
+
+    // The calling thread takes part in the rasterization using the first worker context
+    sw_context_t *recordContext = swCurrentContext;
+    swCurrentContext = &binner->workers[0].context;
+    sw_bin_process_tiles();
+    swCurrentContext = recordContext;
+
+    sw_mutex_lock(&binner->mutex);
+    while (binner->pendingWorkers > 0) sw_cond_wait(&binner->doneCond, &binner->mutex);
+    sw_mutex_unlock(&binner->mutex);
+
+#if SW_ENABLE_STATS
+    // Fragments are counted by the workers, merged into the recording context
+    for (int i = 0; i < binner->threadCount; i++)
+    {
+        const SWstats *stats = &binner->workers[i].context.stats;
+        RLSW.stats.fragmentsShaded += stats->fragmentsShaded;
+        RLSW.stats.fragmentsDepthRejected += stats->fragmentsDepthRejected;
+        RLSW.stats.fragmentsBlended += stats->fragmentsBlended;
+        RLSW.stats.texelsFetched += stats->texelsFetched;
+    }
+#endif
+
+    // Reset recorded data, allocated memory is kept for next frames
+    for (int i = 0; i < binner->tilesX*binner->tilesY; i++) binner->bins[i].count = 0;
+
+    binner->commandCount = 0;
+    binner->stateCount = 0;
+    binner->vertexCount = 0;
+
+    SW_STATS_TIMER_END(rasterTime);
+}
+
+static bool sw_bin_resize(int w, int h)
+{
+    sw_binner_t *binner = &RLSW_BINNER;
+
+    for (int i = 0; i < binner->tilesX*binner->tilesY; i++) SW_FREE(binner->bins[i].commands);
+    SW_FREE(binner->bins);
+
+    binner->tilesX = (w + SW_BINNING_TILE_SIZE - 1)/SW_BINNING_TILE_SIZE;
+    binner->tilesY = (h + SW_BINNING_TILE_SIZE - 1)/SW_BINNING_TILE_SIZE;
+
+    binner->bins = SW_MALLOC(binner->tilesX*binner->tilesY*sizeof(sw_bin_t));
+    if (binner->bins == NULL)
+    {
+        binner->tilesX = binner->tilesY = 0;
+        return false;
+    }
+
+    for (int i = 0; i < binner->tilesX*binner->tilesY; i++) binner->bins[i] = (sw_bin_t) { 0 };
+
+    return true;
+}
+
+static bool sw_bin_init(int w, int h)
+{
+    sw_binner_t *binner = &RLSW_BINNER;
+
+    int threadCount = SW_BINNING_THREADS;
+    if (threadCount <= 0) threadCount = sw_get_processor_count();
+    if (threadCount > SW_MAX_BINNING_THREADS) threadCount = SW_MAX_BINNING_THREADS;
+
+    // A single thread rasterizes primitives immediately, no need for bins
+    if (threadCount < 2) return true;
+
+    binner->workers = SW_MALLOC(threadCount*sizeof(sw_bin_worker_t));
+    if (binner->workers == NULL) return false;
+
+    for (int i = 0; i < threadCount; i++) binner->workers[i].binner = binner;
+
+    if (!sw_bin_resize(w, h)) return false;
+
+    sw_mutex_init(&binner->mutex);
+    sw_cond_init(&binner->startCond);
+    sw_cond_init(&binner->doneCond);
+
+    // NOTE: The first worker context is used by the flushing thread
+    binner->threadCount = 1;
+
+    for (int i = 1; i < threadCount; i++)
+    {
+    #if defined(_MSC_VER)
+        if (thrd_create(&binner->workers[i].thread, sw_bin_worker_entry, &binner->workers[i]) != thrd_success) break;
+    #else
+        if (pthread_create(&binner->workers[i].thread, NULL, sw_bin_worker_entry, &binner->workers[i]) != 0) break;
+    #endif
+        binner->threadCount++;
+    }
+
+    return true;
+}
+
+static void sw_bin_close(void)
+{
+    sw_binner_t *binner = &RLSW_BINNER;
+
+    if (binner->threadCount > 1)
+    {
+        sw_bin_flush();
+
+        sw_mutex_lock(&binner->mutex);
+        binner->quit = true;
+        sw_cond_broadcast(&binner->startCond);
+        sw_mutex_unlock(&binner->mutex);
+
+        for (int i = 1; i < binner->threadCount; i++)
+        {
+        #if defined(_MSC_VER)
+            thrd_join(binner->workers[i].thread, NULL);
+        #else
+            pthread_join(binner->workers[i].thread, NULL);
+        #endif
+        }
+
+        sw_cond_destroy(&binner->doneCond);
+        sw_cond_destroy(&binner->startCond);
+        sw_mutex_destroy(&binner->mutex);
+    }
+
+    for (int i = 0; i < binner->tilesX*binner->tilesY; i++) SW_FREE(binner->bins[i].commands);
+
+    SW_FREE(binner->bins);
+    SW_FREE(binner->commands);
+    SW_FREE(binner->states);
+    SW_FREE(binner->vertices);
+    SW_FREE(binner->workers);
+
+    *binner = (sw_binner_t) { 0 };
+}
+#endif // SW_ENABLE_BINNING
+
+#if SW_ENABLE_ASYNC_PRESENT
+// Asynchronous presentation logic
+// NOTE: The present thread only reads the snapshot, it never accesses the context
+
+static void sw_present_main(sw_presenter_t *presenter)
+{
+    while (true)
+    {
+        sw_mutex_lock(&presenter->mutex);
+        while (!presenter->quit && !presenter->pending) sw_cond_wait(&presenter->startCond, &presenter->mutex);
+        if (presenter->quit)
+        {
+            sw_mutex_unlock(&presenter->mutex);
+            break;
+        }
+        sw_mutex_unlock(&presenter->mutex);
+
+        sw_framebuffer_copy_region(presenter->color, presenter->width, 0, 0, presenter->width, presenter->height,
+            presenter->format, presenter->rowLength, presenter->pixels);
+
+        if (presenter->callback != NULL) presenter->callback(presenter->userData);
+
+        sw_mutex_lock(&presenter->mutex);
+        presenter->pending = false;
+        sw_cond_signal(&presenter->doneCond);
+        sw_mutex_unlock(&presenter->mutex);
+    }
+}
+
+#if defined(_MSC_VER)
+static int sw_present_entry(void *arg) { sw_present_main((sw_presenter_t *)arg); return 0; }
+#else
+static void *sw_present_entry(void *arg) { sw_present_main((sw_presenter_t *)arg); return NULL; }
+#endif
+
+// Start the present thread on first use, presentation stays synchronous if it fails
+static bool sw_present_start(void)
+{
+    sw_presenter_t *presenter = &RLSW_PRESENTER;
+
+    if (presenter->running) return true;
+
+    sw_mutex_init(&presenter->mutex);
+    sw_cond_init(&presenter->startCond);
+    sw_cond_init(&presenter->doneCond);
+
+#if defined(_MSC_VER)
+    presenter->running = (thrd_create(&presenter->thread, sw_present_entry, presenter) == thrd_success);
+#else
+    presenter->running = (pthread_create(&presenter->thread, NULL, sw_present_entry, presenter) == 0);
+#endif
+
+    if (!presenter->running)
+    {
+        sw_cond_destroy(&presenter->doneCond);
+        sw_cond_destroy(&presenter->startCond);
+        sw_mutex_destroy(&presenter->mutex);
+    }
+
+    return presenter->running;
+}
+
+static void sw_present_wait(void)
+{
+    sw_presenter_t *presenter = &RLSW_PRESENTER;
+
+    if (!presenter->running) return;
+
+    sw_mutex_lock(&presenter->mutex);
+    while (presenter->pending) sw_cond_wait(&presenter->doneCond, &presenter->mutex);
+    sw_mutex_unlock(&presenter->mutex);
+}
+
+static void sw_present_close(void)
+{
+    sw_presenter_t *presenter = &RLSW_PRESENTER;
+
+    if (presenter->running)
+    {
+        sw_mutex_lock(&presenter->mutex);
+        while (presenter->pending) sw_cond_wait(&presenter->doneCond, &presenter->mutex);
+        presenter->quit = true;
+        sw_cond_signal(&presenter->startCond);
+        sw_mutex_unlock(&presenter->mutex);
+
+    #if defined(_MSC_VER)
+        thrd_join(presenter->thread, NULL);
+    #else
+        pthread_join(presenter->thread, NULL);
+    #endif
+
+        sw_cond_destroy(&presenter->doneCond);
+        sw_cond_destroy(&presenter->startCond);
+        sw_mutex_destroy(&presenter->mutex);
+    }
+
+    SW_FREE(presenter->color);
+
+    *presenter = (sw_presenter_t) { 0 };
+}
+#endif // SW_ENABLE_ASYNC_PRESENT
+
+// Polygon modes mendering logic
+
+static inline void sw_poly_point_render(void)
+{
+    for (int i = 0; i < RLSW.vertexCounter; i++) sw_point_render(&RLSW.vertexBuffer[i]);
+}
+
+static inline void sw_poly_line_render(void)
+{
+    const sw_vertex_t *vertices = RLSW.vertexBuffer;
+    int cm1 = RLSW.vertexCounter - 1;
+
+    for (int i = 0; i < cm1; i++) sw_line_render((sw_vertex_t[2]){ vertices[i], vertices[i + 1] });
+
+    sw_line_render((sw_vertex_t[2]){ vertices[cm1], vertices[0] });
+}
+
+static inline void sw_poly_fill_render(void)
+{
+    switch (RLSW.drawMode)
+    {
+        case SW_POINTS: sw_point_render(&RLSW.vertexBuffer[0]); break;
+        case SW_LINES: sw_line_render(RLSW.vertexBuffer); break;
+        case SW_TRIANGLES: sw_triangle_render(); break;
+        case SW_QUADS: sw_quad_render(); break;
+    }
+}
+
+static inline void sw_poly_render(void)
+{
+    SW_STATS_ADD(primitivesSubmitted, 1);
+    SW_STATS_TIMER_BEGIN();
+
+    switch (RLSW.polyMode)
+    {
+        case SW_FILL: sw_poly_fill_render(); break;
+        case SW_LINE: sw_poly_line_render(); break;
+        case SW_POINT: sw_poly_point_render(); break;
+        default: break;
+    }
+
+    SW_STATS_TIMER_END(rasterTime);
+}
+
+// Vertex arrays functionality
+// NOTE: Array vertices are transformed in bulk into the vertex cache (one array per component,
+// SW_SIMD_WIDTH vertices at a time) and primitives are then assembled from the cached results,
+// so shared indices are only transformed once
+
+static inline bool sw_vertex_cache_reserve(int count)
+{
+    if (count <= RLSW.vertexCache.capacity) return true;
+
+    int capacity = (RLSW.vertexCache.capacity > 0)? RLSW.vertexCache.capacity : 256;
+    while (capacity < count) capacity *= 2;
+
+    // NOTE: Each array is padded so the last vector stores never overrun the next one
+    int stride = capacity + SW_SIMD_WIDTH;
+    float *data = SW_REALLOC(RLSW.vertexCache.data, 10*stride*sizeof(float));
+
+    if (data == NULL)
+    {
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return false;
+    }
+
+    RLSW.vertexCache.data = data;
+    RLSW.vertexCache.x = data;
+    RLSW.vertexCache.y = data + stride;
+    RLSW.vertexCache.z = data + 2*stride;
+    RLSW.vertexCache.w = data + 3*stride;
+    RLSW.vertexCache.u = data + 4*stride;
+    RLSW.vertexCache.v = data + 5*stride;
+    RLSW.vertexCache.r = data + 6*stride;
+    RLSW.vertexCache.g = data + 7*stride;
+    RLSW.vertexCache.b = data + 8*stride;
+    RLSW.vertexCache.a = data + 9*stride;
+    RLSW.vertexCache.capacity = capacity;
+
+    return true;
+}
+
+// Transform the array vertices [first, first + count) into the cache entries [0, count)
+static inline void sw_vertex_cache_transform(int first, int count)
+{
+    const float *m = RLSW.matMVP;
+    const float *t = RLSW.stackTexture[RLSW.stackTextureCounter - 1];
+
+    const float *positions = RLSW.array.positions + 3*first;
+    const float *texcoords = (RLSW.array.texcoords != NULL)? RLSW.array.texcoords + 2*first : NULL;
+    const uint8_t *colors = (RLSW.array.colors != NULL)? RLSW.array.colors + 4*first : NULL;
+
+    const sw_simd_t m0 = sw_simd_set1(m[0]), m1 = sw_simd_set1(m[1]), m2 = sw_simd_set1(m[2]), m3 = sw_simd_set1(m[3]);
+    const sw_simd_t m4 = sw_simd_set1(m[4]), m5 = sw_simd_set1(m[5]), m6 = sw_simd_set1(m[6]), m7 = sw_simd_set1(m[7]);
+    const sw_simd_t m8 = sw_simd_set1(m[8]), m9 = sw_simd_set1(m[9]), m10 = sw_simd_set1(m[10]), m11 = sw_simd_set1(m[11]);
+    const sw_simd_t m12 = sw_simd_set1(m[12]), m13 = sw_simd_set1(m[13]), m14 = sw_simd_set1(m[14]), m15 = sw_simd_set1(m[15]);
+
+    const sw_simd_t t0 = sw_simd_set1(t[0]), t1 = sw_simd_set1(t[1]);
+    const sw_simd_t t4 = sw_simd_set1(t[4]), t5 = sw_simd_set1(t[5]);
+    const sw_simd_t t12 = sw_simd_set1(t[12]), t13 = sw_simd_set1(t[13]);
+
+    const sw_simd_t rcp255 = sw_simd_set1(1.0f/255);
+
+    for (int i = 0; i < count; i += SW_SIMD_WIDTH)
+    {
+        int n = count - i;
+        if (n > SW_SIMD_WIDTH) n = SW_SIMD_WIDTH;
+
+        // Deinterleave the input components
+        float px[SW_SIMD_WIDTH] = { 0 }, py[SW_SIMD_WIDTH] = { 0 }, pz[SW_SIMD_WIDTH] = { 0 };
+        for (int j = 0; j < n; j++)
+        {
+            px[j] = positions[3*(i + j)];
+            py[j] = positions[3*(i + j) + 1];
+            pz[j] = positions[3*(i + j) + 2];
+        }
+
+        // Calculation of homogeneous coordinates (w == 1)
+        sw_simd_t x = sw_simd_load(px);
+        sw_simd_t y = sw_simd_load(py);
+        sw_simd_t z = sw_simd_load(pz);
+
+        sw_simd_store(RLSW.vertexCache.x + i, sw_simd_add(sw_simd_add(sw_simd_add(sw_simd_mul(m0, x), sw_simd_mul(m4, y)), sw_simd_mul(m8, z)), m12));
+        sw_simd_store(RLSW.vertexCache.y + i, sw_simd_add(sw_simd_add(sw_simd_add(sw_simd_mul(m1, x), sw_simd_mul(m5, y)), sw_simd_mul(m9, z)), m13));
+        sw_simd_store(RLSW.vertexCache.z + i, sw_simd_add(sw_simd_add(sw_simd_add(sw_simd_mul(m2, x), sw_simd_mul(m6, y)), sw_simd_mul(m10, z)), m14));
+        sw_simd_store(RLSW.vertexCache.w + i, sw_simd_add(sw_simd_add(sw_simd_add(sw_simd_mul(m3, x), sw_simd_mul(m7, y)), sw_simd_mul(m11, z)), m15));
+
+        // Texture coordinates, (0, 0) when no array is bound
+        float tu[SW_SIMD_WIDTH] = { 0 }, tv[SW_SIMD_WIDTH] = { 0 };
+        if (texcoords != NULL)
+        {
+            for (int j = 0; j < n; j++)
+            {
+                tu[j] = texcoords[2*(i + j)];
+                tv[j] = texcoords[2*(i + j) + 1];
+            }
+        }
+
+        sw_simd_t u = sw_simd_load(tu);
+        sw_simd_t v = sw_simd_load(tv);
+
+        sw_simd_store(RLSW.vertexCache.u + i, sw_simd_add(sw_simd_add(sw_simd_mul(t0, u), sw_simd_mul(t4, v)), t12));
+        sw_simd_store(RLSW.vertexCache.v + i, sw_simd_add(sw_simd_add(sw_simd_mul(t1, u), sw_simd_mul(t5, v)), t13));
+
+        // Colors, white when no array is bound
+        float cr[SW_SIMD_WIDTH], cg[SW_SIMD_WIDTH], cb[SW_SIMD_WIDTH], ca[SW_SIMD_WIDTH];
+        for (int j = 0; j < SW_SIMD_WIDTH; j++)
+        {
+            if ((colors != NULL) && (j < n))
+            {
+                cr[j] = (float)colors[4*(i + j)];
+                cg[j] = (float)colors[4*(i + j) + 1];
+                cb[j] = (float)colors[4*(i + j) + 2];
+                ca[j] = (float)colors[4*(i + j) + 3];
+            }
+            else cr[j] = cg[j] = cb[j] = ca[j] = 255.0f;
+        }
+
+        sw_simd_store(RLSW.vertexCache.r + i, sw_simd_mul(sw_simd_load(cr), rcp255));
+        sw_simd_store(RLSW.vertexCache.g + i, sw_simd_mul(sw_simd_load(cg), rcp255));
+        sw_simd_store(RLSW.vertexCache.b + i, sw_simd_mul(sw_simd_load(cb), rcp255));
+        sw_simd_store(RLSW.vertexCache.a + i, sw_simd_mul(sw_simd_load(ca), rcp255));
+    }
+}
+
+// Copy a cached vertex to the primitive vertex buffer and render the primitive once complete
+// NOTE: The object space position is not needed after the transformation, so it is not copied
+static inline void sw_vertex_cache_emit(int i)
+{
+    sw_vertex_t *vertex = &RLSW.vertexBuffer[RLSW.vertexCounter++];
+
+    vertex->texcoord[0] = RLSW.vertexCache.u[i];
+    vertex->texcoord[1] = RLSW.vertexCache.v[i];
+
+    vertex->color[0] = RLSW.vertexCache.r[i];
+    vertex->color[1] = RLSW.vertexCache.g[i];
+    vertex->color[2] = RLSW.vertexCache.b[i];
+    vertex->color[3] = RLSW.vertexCache.a[i];
+
+    vertex->homogeneous[0] = RLSW.vertexCache.x[i];
+    vertex->homogeneous[1] = RLSW.vertexCache.y[i];
+    vertex->homogeneous[2] = RLSW.vertexCache.z[i];
+    vertex->homogeneous[3] = RLSW.vertexCache.w[i];
+
+    if (RLSW.vertexCounter == RLSW.reqVertices)
+    {
+        sw_poly_render();
+        RLSW.vertexCounter = 0;
+    }
+}
+
+static inline uint32_t sw_get_index(const void *indices, SWtype type, int i)
+{
+    switch (type)
+    {
+        case SW_UNSIGNED_BYTE: return ((const uint8_t *)indices)[i];
+        case SW_UNSIGNED_SHORT: return ((const uint16_t *)indices)[i];
+        default: break;
+    }
+
+    return ((const uint32_t *)indices)[i];
+}
+
+// Texture storage functionality
+
+// Internal format a texture is stored in, formats other than RGBA8 and grayscale
+// are converted at upload so sampling does not have to decode them
+static inline sw_pixelformat_t sw_texture_get_internal_format(sw_pixelformat_t format)
+{
+    if (!SW_TEXTURE_CONVERT) return format;
+
+    switch (format)
+    {
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        case SW_PIXELFORMAT_DEPTH: return format;
+        default: break;
+    }
+
+    return SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+
+// Store rows of pixels in the texture storage layout, converted to RGBA8 if formats differ
+// NOTE: Tiled storage (4x4 texel blocks) is padded to whole blocks
+static inline void sw_texture_store(void *dst, const void *src, int width, int height,
+                                    sw_pixelformat_t srcFormat, sw_pixelformat_t dstFormat, bool tiled)
+{
+    int bytes = sw_get_pixel_bytes(dstFormat);
+    int tileStride = (width + 3)/4;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int srcOffset = y*width + x;
+            int dstOffset = tiled? ((((y >> 2)*tileStride + (x >> 2)) << 4) + ((y & 3) << 2) + (x & 3)) : srcOffset;
+            uint8_t *texel = (uint8_t *)dst + bytes*dstOffset;
+
+            if (srcFormat == dstFormat)
+            {
+                const uint8_t *srcTexel = (const uint8_t *)src + bytes*srcOffset;
+                for (int i = 0; i < bytes; i++) texel[i] = srcTexel[i];
+            }
+            else
+            {
+                float color[4];
+                sw_get_pixel(color, src, srcOffset, srcFormat);
+                for (int i = 0; i < 4; i++) texel[i] = (uint8_t)(sw_saturate(color[i])*255.0f + 0.5f);
+            }
+        }
+    }
+}
+
+static inline bool sw_texture_set_image(sw_texture_t *texture, int width, int height, sw_pixelformat_t format, bool copy, const void *data)
+{
+    // Data in a format decoded on every fetch gets its own converted storage, even if referenced
+    sw_pixelformat_t internalFormat = sw_texture_get_internal_format(format);
+    bool convert = (data != NULL) && (internalFormat != format);
+    if (convert) copy = true;
+
+    // NOTE: Only textures with data are tiled, render targets are rendered into in rows
+    bool tiled = SW_TEXTURE_TILED && copy && (data != NULL);
+
+    if (copy)
+    {
+        int bytes = sw_get_pixel_bytes(internalFormat);
+        int size = tiled? bytes*16*((width + 3)/4)*((height + 3)/4) : bytes*width*height;
+        texture->pixels.ptr = SW_MALLOC(size);
+
+        if (texture->pixels.ptr == NULL)
+        {
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARING: Out of memory...
+            return false;
+        }
+
+        // NOTE: No data only allocates the storage, render targets are defined this way
+        if (data == NULL) for (int i = 0; i < size; i++) ((uint8_t *)texture->pixels.ptr)[i] = 0;
+        else sw_texture_store(texture->pixels.ptr, data, width, height, format, internalFormat, tiled);
+    }
+    else texture->pixels.cptr = data;
+
+    texture->tiled = tiled;
+    texture->tileStride = (width + 3)/4;
+    texture->width = width;
+    texture->height = height;
+    texture->wMinus1 = width - 1;
+    texture->hMinus1 = height - 1;
+    texture->isPOT = ((width & (width - 1)) == 0) && ((height & (height - 1)) == 0);
+    texture->format = internalFormat;
+    texture->tx = 1.0f/width;
+    texture->ty = 1.0f/height;
+    texture->copy = copy;
+
+    return true;
+}
+
+// Number of levels of a complete mipmap chain, down to 1x1
+static inline int sw_texture_get_max_levels(int width, int height)
+{
+    int size = (width > height)? width : height;
+    int levels = 1;
+
+    while (size > 1) { size >>= 1; levels++; }
+
+    return levels;
+}
+
+// Initialize a mipmap level record, sharing the sampling parameters of the base level
+static inline sw_texture_t *sw_texture_init_level(sw_texture_t *texture, int level)
+{
+    sw_texture_t *mipmap = &texture->mipmaps[level - 1];
+
+    *mipmap = *texture;
+    mipmap->pixels.cptr = NULL;
+    mipmap->copy = false;
+    mipmap->mipmaps = NULL;
+    mipmap->mipmapCount = 1;
+
+    return mipmap;
+}
+
+static inline void sw_texture_free_mipmaps(sw_texture_t *texture)
+{
+    for (int i = 0; i < texture->mipmapCount - 1; i++)
+    {
+        if (texture->mipmaps[i].copy) SW_FREE(texture->mipmaps[i].pixels.ptr);
+    }
+
+    SW_FREE(texture->mipmaps);
+
+    texture->mipmaps = NULL;
+    texture->mipmapCount = 1;
+}
+
+// Box filter a texture level into the next one (RGBA8)
+// NOTE: Odd dimensions clamp the last row/column, NPOT chains are slightly shifted
+static inline void sw_texture_downsample_rgba8(uint8_t *dst, int width, int height, const sw_texture_t *src)
+{
+    for (int y = 0; y < height; y++)
+    {
+        int y0 = 2*y;
+        int y1 = (y0 < src->hMinus1)? y0 + 1 : src->hMinus1;
+
+        for (int x = 0; x < width; x++)
+        {
+            int x0 = 2*x;
+            int x1 = (x0 < src->wMinus1)? x0 + 1 : src->wMinus1;
+
+            float c00[4], c10[4], c01[4], c11[4];
+            sw_get_pixel(c00, src->pixels.cptr, sw_texture_texel_offset(src, x0, y0), src->format);
+            sw_get_pixel(c10, src->pixels.cptr, sw_texture_texel_offset(src, x1, y0), src->format);
+            sw_get_pixel(c01, src->pixels.cptr, sw_texture_texel_offset(src, x0, y1), src->format);
+            sw_get_pixel(c11, src->pixels.cptr, sw_texture_texel_offset(src, x1, y1), src->format);
+
+            for (int i = 0; i < 4; i++)
+            {
+                float c = 0.25f*(c00[i] + c10[i] + c01[i] + c11[i]);
+                dst[i] = (uint8_t)(sw_saturate(c)*255.0f + 0.5f);
+            }
+
+            dst += 4;
+        }
+    }
+}
+
+// Validity check helper functions
+
+static inline bool sw_is_texture_valid(uint32_t id)
+{
+    bool valid = true;
+
+    if (id == 0) valid = false;
+    else if (id >= SW_MAX_TEXTURES) valid = false;
+    else if (RLSW.loadedTextures[id].pixels.cptr == 0) valid = false;
+
+    return true;
+}
+
+static inline bool sw_is_texture_filter_valid(int filter)
+{
+    return (filter == SW_NEAREST || filter == SW_LINEAR);
+}
+
+static inline bool sw_is_texture_min_filter_valid(int filter)
+{
+    bool result = false;
+
+    switch (filter)
+    {
+        case SW_NEAREST:
+        case SW_LINEAR:
+        case SW_NEAREST_MIPMAP_NEAREST:
+        case SW_LINEAR_MIPMAP_NEAREST:
+        case SW_NEAREST_MIPMAP_LINEAR:
+        case SW_LINEAR_MIPMAP_LINEAR: result = true; break;
+        default: break;
+    }
+
+    return result;
+}
+
+static inline bool sw_is_texture_wrap_valid(int wrap)
+{
+    return (wrap == SW_REPEAT || wrap == SW_CLAMP);
+}
+
+static inline bool sw_is_draw_mode_valid(int mode)
+{
+    bool result = false;
+
+    switch (mode)
+    {
+        case SW_POINTS:
+        case SW_LINES:
+        case SW_TRIANGLES:
+        case SW_QUADS: result = true; break;
+        default: break;
+    }
+
+    return result;
+}
+
+static inline bool sw_is_poly_mode_valid(int mode)
+{
+    bool result = false;
+
+    switch (mode)
+    {
+        case SW_POINT:
+        case SW_LINE:
+        case SW_FILL: result = true; break;
+        default: break;
+    }
+
+    return result;
+}
+
+static inline bool sw_is_face_valid(int face)
+{
+    return (face == SW_FRONT || face == SW_BACK);
+}
+
+static inline bool sw_is_blend_src_factor_valid(int blend)
+{
+    bool result = false;
+
+    switch (blend)
+    {
+        case SW_ZERO:
+        case SW_ONE:
+        case SW_SRC_COLOR:
+        case SW_ONE_MINUS_SRC_COLOR:
+        case SW_SRC_ALPHA:
+        case SW_ONE_MINUS_SRC_ALPHA:
+        case SW_DST_ALPHA:
+        case SW_ONE_MINUS_DST_ALPHA:
+        case SW_DST_COLOR:
+        case SW_ONE_MINUS_DST_COLOR:
+        case SW_SRC_ALPHA_SATURATE: result = true; break;
+        default: break;
+    }
+
+    return result;
+}
+
+static inline bool sw_is_blend_dst_factor_valid(int blend)
+{
+    bool result = false;
+
+    switch (blend)
+    {
+        case SW_ZERO:
+        case SW_ONE:
+        case SW_SRC_COLOR:
+        case SW_ONE_MINUS_SRC_COLOR:
+        case SW_SRC_ALPHA:
         case SW_ONE_MINUS_SRC_ALPHA:
         case SW_DST_ALPHA:
         case SW_ONE_MINUS_DST_ALPHA:
@@ -3804,24 +7214,436 @@ static inline bool sw_is_blend_dst_factor_valid(int blend)
         default: break;
     }
 
-    return result;
+    return result;
+}
+
+// Framebuffer object management functionality
+
+static inline bool sw_is_framebuffer_valid(uint32_t id)
+{
+    return (id > 0) && (id < (uint32_t)RLSW.loadedFramebufferCount) && RLSW.loadedFramebuffers[id].generated;
+}
+
+// Check the texture id names a generated texture, deleted ones are in the free list
+static inline bool sw_is_texture_generated(uint32_t id)
+{
+    const sw_texture_pool_t *pool = RLSW.texturePool;
+    bool generated = true;
+
+    SW_TEXTURE_POOL_LOCK();
+
+    if ((id == 0) || (id >= (uint32_t)pool->textureCount)) generated = false;
+
+    for (int i = 0; generated && (i < pool->freeIdCount); i++)
+    {
+        if (pool->freeIds[i] == id) generated = false;
+    }
+
+    SW_TEXTURE_POOL_UNLOCK();
+
+    return generated;
+}
+
+// Make the texture base level owned storage in the given format, so it can be rendered into
+// NOTE: Color textures are converted once, rendering then writes them in place
+static bool sw_fbo_prepare_texture(sw_texture_t *texture, sw_pixelformat_t format)
+{
+    if (texture->copy && (texture->format == format) && !texture->tiled) return true;
+
+    int size = texture->width*texture->height;
+    int bytes = sw_get_pixel_bytes(format);
+
+    void *pixels = SW_MALLOC(bytes*size);
+    if (pixels == NULL)
+    {
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return false;
+    }
+
+    if (texture->pixels.cptr == NULL)
+    {
+        for (int i = 0; i < bytes*size; i++) ((uint8_t *)pixels)[i] = 0;
+    }
+    else if (texture->format == format)
+    {
+        // Tiled storage is restored in rows
+        for (int i = 0; i < size; i++)
+        {
+            int offset = sw_texture_texel_offset(texture, i%texture->width, i/texture->width);
+            const uint8_t *src = (const uint8_t *)texture->pixels.cptr + bytes*offset;
+            for (int j = 0; j < bytes; j++) ((uint8_t *)pixels)[bytes*i + j] = src[j];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < size; i++)
+        {
+            float color[4];
+            sw_get_pixel(color, texture->pixels.cptr, sw_texture_texel_offset(texture, i%texture->width, i/texture->width), texture->format);
+            sw_framebuffer_write_color(sw_framebuffer_get_color_addr(pixels, i), color);
+        }
+    }
+
+    if (texture->copy) SW_FREE(texture->pixels.ptr);
+
+    texture->pixels.ptr = pixels;
+    texture->format = format;
+    texture->copy = true;
+    texture->tiled = false;
+
+    return true;
+}
+
+// Without depth attachment, an internal depth buffer is used (renderbuffer-like)
+static inline bool sw_fbo_load_depth(sw_fbo_t *fbo, int size)
+{
+    if (size <= fbo->depthAllocSz) return true;
+
+    void *newDepth = SW_REALLOC(fbo->depth, SW_DEPTH_PIXEL_SIZE*size);
+    if (newDepth == NULL) return false;
+
+    for (int i = 0; i < size; i++) sw_framebuffer_write_depth(sw_framebuffer_get_depth_addr(newDepth, i), 1.0f);
+
+    fbo->depth = newDepth;
+    fbo->depthAllocSz = size;
+
+    return true;
+}
+
+static SWfbstatus sw_fbo_get_status(const sw_fbo_t *fbo)
+{
+    if (fbo->colorTexture == 0) return SW_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT;
+
+    const sw_texture_t *color = &RLSW.loadedTextures[fbo->colorTexture];
+    if ((color->format != SW_FRAMEBUFFER_COLOR_FORMAT) || (color->pixels.cptr == NULL) || !color->copy)
+    {
+        return SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+    }
+
+    if (fbo->depthTexture != 0)
+    {
+        const sw_texture_t *depth = &RLSW.loadedTextures[fbo->depthTexture];
+        if ((depth->format != SW_PIXELFORMAT_DEPTH) || (depth->pixels.cptr == NULL) || !depth->copy)
+        {
+            return SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+        }
+
+        // Attachments of different sizes are not supported
+        if ((depth->width != color->width) || (depth->height != color->height)) return SW_FRAMEBUFFER_UNSUPPORTED;
+    }
+
+    return SW_FRAMEBUFFER_COMPLETE;
+}
+
+// Point the bound framebuffer to the attachments of the current framebuffer object
+// NOTE: An incomplete framebuffer object is bound as an empty target, all drawing is discarded
+static void sw_fbo_bind_target(void)
+{
+    sw_fbo_t *fbo = &RLSW.loadedFramebuffers[RLSW.currentFramebuffer];
+    int w = 0, h = 0;
+    void *color = NULL;
+    void *depth = NULL;
+
+    // Attached textures are rendered into directly, their storage must match the buffers layout
+    // NOTE: Depth storage can not be converted, other formats leave the framebuffer incomplete
+    if (fbo->colorTexture != 0) sw_fbo_prepare_texture(&RLSW.loadedTextures[fbo->colorTexture], SW_FRAMEBUFFER_COLOR_FORMAT);
+    if ((fbo->depthTexture != 0) && (RLSW.loadedTextures[fbo->depthTexture].format == SW_PIXELFORMAT_DEPTH))
+    {
+        sw_fbo_prepare_texture(&RLSW.loadedTextures[fbo->depthTexture], SW_PIXELFORMAT_DEPTH);
+    }
+
+    if (sw_fbo_get_status(fbo) == SW_FRAMEBUFFER_COMPLETE)
+    {
+        sw_texture_t *colorTexture = &RLSW.loadedTextures[fbo->colorTexture];
+        w = colorTexture->width;
+        h = colorTexture->height;
+        color = colorTexture->pixels.ptr;
+
+        if (fbo->depthTexture != 0) depth = RLSW.loadedTextures[fbo->depthTexture].pixels.ptr;
+        else if (sw_fbo_load_depth(fbo, w*h)) depth = fbo->depth;
+
+        if (depth == NULL)
+        {
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+            w = h = 0;
+            color = NULL;
+        }
+    }
+
+    RLSW.framebuffer.color = color;
+    RLSW.framebuffer.depth = depth;
+    RLSW.framebuffer.hiz = fbo->hiz;
+    RLSW.framebuffer.hizAllocSz = fbo->hizAllocSz;
+    RLSW.framebuffer.bottomUp = true;
+
+    if (!sw_framebuffer_load_hiz(w, h))
+    {
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        w = h = 0;
+        RLSW.framebuffer.color = RLSW.framebuffer.depth = NULL;
+        sw_framebuffer_load_hiz(0, 0);
+    }
+
+    fbo->hiz = RLSW.framebuffer.hiz;
+    fbo->hizAllocSz = RLSW.framebuffer.hizAllocSz;
+
+    RLSW.framebuffer.width = w;
+    RLSW.framebuffer.height = h;
+    RLSW.framebuffer.allocSz = w*h;
+
+    RLSW.rasterMin[0] = RLSW.rasterMin[1] = 0;
+    RLSW.rasterMax[0] = w;
+    RLSW.rasterMax[1] = h;
+
+    // Attached textures may have been sampled or redefined since last bound
+    sw_framebuffer_reset_tracking();
+
+#if SW_ENABLE_BINNING
+    // Bins are only grown, tiles out of the framebuffer stay empty
+    sw_binner_t *binner = &RLSW_BINNER;
+    if (sw_bin_is_active() && ((w > binner->tilesX*SW_BINNING_TILE_SIZE) || (h > binner->tilesY*SW_BINNING_TILE_SIZE)))
+    {
+        int binWidth = (w > binner->tilesX*SW_BINNING_TILE_SIZE)? w : binner->tilesX*SW_BINNING_TILE_SIZE;
+        int binHeight = (h > binner->tilesY*SW_BINNING_TILE_SIZE)? h : binner->tilesY*SW_BINNING_TILE_SIZE;
+        if (!sw_bin_resize(binWidth, binHeight)) RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+    }
+#endif
+}
+
+// Rebind the target if the texture is attached to the current framebuffer object
+static inline void sw_fbo_texture_changed(uint32_t id)
+{
+    if (RLSW.currentFramebuffer == 0) return;
+
+    const sw_fbo_t *fbo = &RLSW.loadedFramebuffers[RLSW.currentFramebuffer];
+    if ((fbo->colorTexture == id) || (fbo->depthTexture == id)) sw_fbo_bind_target();
+}
+
+// Record a framebuffer object attachment of the texture in the current context
+// NOTE: Shared textures attached in another context are refused, its framebuffer objects would keep
+// the id of the texture if deleted from here, and then render into the texture reusing that id
+static bool sw_fbo_attach_texture(uint32_t id)
+{
+#if SW_ENABLE_CONTEXTS
+    if (id == 0) return true;
+
+    sw_texture_t *texture = &RLSW.loadedTextures[id];
+    bool attached = true;
+
+    SW_TEXTURE_POOL_LOCK();
+
+    if ((texture->fboAttachments > 0) && (texture->fboContext != RLSW.owner)) attached = false;
+    else
+    {
+        texture->fboContext = RLSW.owner;
+        texture->fboAttachments++;
+    }
+
+    SW_TEXTURE_POOL_UNLOCK();
+
+    return attached;
+#else
+    (void)id;
+    return true;
+#endif
+}
+
+static void sw_fbo_detach_texture(uint32_t id)
+{
+#if SW_ENABLE_CONTEXTS
+    if (id == 0) return;
+
+    sw_texture_t *texture = &RLSW.loadedTextures[id];
+
+    SW_TEXTURE_POOL_LOCK();
+
+    if (texture->fboAttachments > 0) texture->fboAttachments--;
+    if (texture->fboAttachments == 0) texture->fboContext = NULL;
+
+    SW_TEXTURE_POOL_UNLOCK();
+#else
+    (void)id;
+#endif
+}
+
+// Check the texture is not attached to framebuffer objects of another context
+static bool sw_fbo_is_texture_attached_elsewhere(uint32_t id)
+{
+#if SW_ENABLE_CONTEXTS
+    const sw_texture_t *texture = &RLSW.loadedTextures[id];
+
+    SW_TEXTURE_POOL_LOCK();
+    bool attached = (texture->fboAttachments > 0) && (texture->fboContext != RLSW.owner);
+    SW_TEXTURE_POOL_UNLOCK();
+
+    return attached;
+#else
+    (void)id;
+    return false;
+#endif
+}
+
+// Clear the buffers of the bound framebuffer, restricted to the scissor rectangle if enabled
+static void sw_framebuffer_clear(uint32_t bitmask)
+{
+#if SW_ENABLE_BINNING
+    if (sw_bin_push(SW_BIN_CMD_CLEAR, NULL, 0, bitmask)) return;
+#endif
+
+    SW_STATS_TIMER_BEGIN();
+
+    int size = RLSW.framebuffer.width*RLSW.framebuffer.height;
+
+    if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT))
+    {
+        sw_framebuffer_fill(RLSW.framebuffer.color, RLSW.framebuffer.depth,size, RLSW.clearColor, RLSW.clearDepth);
+    }
+    else if (bitmask & (SW_COLOR_BUFFER_BIT))
+    {
+        sw_framebuffer_fill_color(RLSW.framebuffer.color, size, RLSW.clearColor);
+    }
+    else if (bitmask & SW_DEPTH_BUFFER_BIT)
+    {
+        sw_framebuffer_fill_depth(RLSW.framebuffer.depth, size, RLSW.clearDepth);
+    }
+
+    if (bitmask & SW_DEPTH_BUFFER_BIT) sw_hiz_clear();
+
+    SW_STATS_TIMER_END(clearTime);
+}
+
+// Texture objects and contexts management logic
+
+static sw_texture_pool_t *sw_texture_pool_create(void)
+{
+    sw_texture_pool_t *pool = SW_MALLOC(sizeof(sw_texture_pool_t));
+    if (pool == NULL) return NULL;
+
+    *pool = (sw_texture_pool_t) { 0 };
+
+    pool->textures = SW_MALLOC(SW_MAX_TEXTURES*sizeof(sw_texture_t));
+    pool->freeIds = SW_MALLOC(SW_MAX_TEXTURES*sizeof(uint32_t));
+
+    if ((pool->textures == NULL) || (pool->freeIds == NULL))
+    {
+        SW_FREE(pool->textures);
+        SW_FREE(pool->freeIds);
+        SW_FREE(pool);
+        return NULL;
+    }
+
+    static const float defTex[3*2*2] = {
+        1.0f, 1.0f, 1.0f,
+        1.0f, 1.0f, 1.0f,
+        1.0f, 1.0f, 1.0f,
+        1.0f, 1.0f, 1.0f,
+    };
+
+    pool->textures[0].pixels.cptr = defTex;
+    pool->textures[0].width = 2;
+    pool->textures[0].height = 2;
+    pool->textures[0].wMinus1 = 1;
+    pool->textures[0].hMinus1 = 1;
+    pool->textures[0].format = SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32;
+    pool->textures[0].tiled = false;
+    pool->textures[0].tileStride = 1;
+    pool->textures[0].minFilter = SW_NEAREST;
+    pool->textures[0].magFilter = SW_NEAREST;
+    pool->textures[0].sWrap = SW_REPEAT;
+    pool->textures[0].tWrap = SW_REPEAT;
+    pool->textures[0].tx = 0.5f;
+    pool->textures[0].ty = 0.5f;
+    pool->textures[0].copy = false;
+    pool->textures[0].mipmaps = NULL;
+    pool->textures[0].mipmapCount = 1;
+#if SW_ENABLE_CONTEXTS
+    pool->textures[0].fboContext = NULL;
+    pool->textures[0].fboAttachments = 0;
+#endif
+
+    pool->textureCount = 1;
+    pool->refCount = 1;
+
+#if SW_ENABLE_CONTEXTS
+    sw_mutex_init(&pool->mutex);
+#endif
+
+    return pool;
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition
-//----------------------------------------------------------------------------------
-bool swInit(int w, int h)
+// Texture objects are freed along with the last context using them
+static void sw_texture_pool_release(sw_texture_pool_t *pool)
+{
+    if (pool == NULL) return;
+
+#if SW_ENABLE_CONTEXTS
+    sw_mutex_lock(&pool->mutex);
+    int refCount = --pool->refCount;
+    sw_mutex_unlock(&pool->mutex);
+#else
+    int refCount = --pool->refCount;
+#endif
+
+    if (refCount > 0) return;
+
+    for (int i = 1; i < pool->textureCount; i++)
+    {
+        sw_texture_t *texture = &pool->textures[i];
+
+        if (texture->copy) SW_FREE(texture->pixels.ptr);
+        sw_texture_free_mipmaps(texture);
+    }
+
+#if SW_ENABLE_CONTEXTS
+    sw_mutex_destroy(&pool->mutex);
+#endif
+
+    SW_FREE(pool->textures);
+    SW_FREE(pool->freeIds);
+    SW_FREE(pool);
+}
+
+static void sw_context_close(void);
+
+// Initialize the current context, texture objects are shared with the given pool if any
+static bool sw_context_init(SWcontext *context, int w, int h, sw_texture_pool_t *sharedPool)
 {
-    if (!sw_framebuffer_load(w, h)) { swClose(); return false; }
+#if SW_ENABLE_CONTEXTS
+    RLSW.owner = context;
+#else
+    (void)context;
+#endif
+
+    if (!sw_framebuffer_load(w, h)) { sw_context_close(); return false; }
 
     swViewport(0, 0, w, h);
     swScissor(0, 0, w, h);
 
-    RLSW.loadedTextures = SW_MALLOC(SW_MAX_TEXTURES*sizeof(sw_texture_t));
-    if (RLSW.loadedTextures == NULL) { swClose(); return false; }
+    if (sharedPool != NULL)
+    {
+    #if SW_ENABLE_CONTEXTS
+        sw_mutex_lock(&sharedPool->mutex);
+        sharedPool->refCount++;
+        sw_mutex_unlock(&sharedPool->mutex);
+    #else
+        sharedPool->refCount++;
+    #endif
+        RLSW.texturePool = sharedPool;
+    }
+    else RLSW.texturePool = sw_texture_pool_create();
+
+    if (RLSW.texturePool == NULL) { sw_context_close(); return false; }
+
+    RLSW.loadedTextures = RLSW.texturePool->textures;
+
+    RLSW.loadedFramebuffers = SW_MALLOC(SW_MAX_FRAMEBUFFERS*sizeof(sw_fbo_t));
+    if (RLSW.loadedFramebuffers == NULL) { sw_context_close(); return false; }
 
-    RLSW.freeTextureIds = SW_MALLOC(SW_MAX_TEXTURES*sizeof(uint32_t));
-    if (RLSW.loadedTextures == NULL) { swClose(); return false; }
+    RLSW.freeFramebufferIds = SW_MALLOC(SW_MAX_FRAMEBUFFERS*sizeof(uint32_t));
+    if (RLSW.freeFramebufferIds == NULL) { sw_context_close(); return false; }
+
+    RLSW.loadedFramebuffers[0] = (sw_fbo_t) { 0 };
+    RLSW.loadedFramebufferCount = 1;    // Id 0 is the main framebuffer
 
     RLSW.clearColor[0] = 0.0f;
     RLSW.clearColor[1] = 0.0f;
@@ -3859,55 +7681,199 @@ bool swInit(int w, int h)
     RLSW.polyMode = SW_FILL;
     RLSW.cullFace = SW_BACK;
 
-    static const float defTex[3*2*2] = {
-        1.0f, 1.0f, 1.0f,
-        1.0f, 1.0f, 1.0f,
-        1.0f, 1.0f, 1.0f,
-        1.0f, 1.0f, 1.0f,
-    };
-
-    RLSW.loadedTextures[0].pixels.cptr = defTex;
-    RLSW.loadedTextures[0].width = 2;
-    RLSW.loadedTextures[0].height = 2;
-    RLSW.loadedTextures[0].wMinus1 = 1;
-    RLSW.loadedTextures[0].hMinus1 = 1;
-    RLSW.loadedTextures[0].format = SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32;
-    RLSW.loadedTextures[0].minFilter = SW_NEAREST;
-    RLSW.loadedTextures[0].magFilter = SW_NEAREST;
-    RLSW.loadedTextures[0].sWrap = SW_REPEAT;
-    RLSW.loadedTextures[0].tWrap = SW_REPEAT;
-    RLSW.loadedTextures[0].tx = 0.5f;
-    RLSW.loadedTextures[0].ty = 0.5f;
-    RLSW.loadedTextures[0].copy = false;
-
-    RLSW.loadedTextureCount = 1;
+#if SW_ENABLE_BINNING
+    if (!sw_bin_init(w, h)) { sw_context_close(); return false; }
+#endif
 
     return true;
 }
 
-void swClose(void)
+// Close the current context, its texture objects are kept while shared with other contexts
+static void sw_context_close(void)
 {
-    for (int i = 1; i < RLSW.loadedTextureCount; i++)
+#if SW_ENABLE_BINNING
+    sw_bin_close();
+#endif
+
+#if SW_ENABLE_ASYNC_PRESENT
+    sw_present_close();
+#endif
+
+    // Framebuffer objects only reference texture storage, the main framebuffer is restored first
+    if (RLSW.currentFramebuffer != 0)
     {
-        sw_texture_t *texture = &RLSW.loadedTextures[i];
-        if (sw_is_texture_valid(i) && texture->copy) SW_FREE(texture->pixels.ptr);
+        RLSW.framebuffer = RLSW.mainFramebuffer;
+        RLSW.currentFramebuffer = 0;
     }
 
-    SW_FREE(RLSW.framebuffer.color);
-    SW_FREE(RLSW.framebuffer.depth);
-    SW_FREE(RLSW.loadedTextures);
-    SW_FREE(RLSW.freeTextureIds);
+    for (int i = 1; i < RLSW.loadedFramebufferCount; i++)
+    {
+        // Shared textures outlive the context, their attachments are released
+        if (RLSW.loadedFramebuffers[i].generated)
+        {
+            sw_fbo_detach_texture(RLSW.loadedFramebuffers[i].colorTexture);
+            sw_fbo_detach_texture(RLSW.loadedFramebuffers[i].depthTexture);
+        }
+
+        SW_FREE(RLSW.loadedFramebuffers[i].depth);
+        SW_FREE(RLSW.loadedFramebuffers[i].hiz);
+    }
 
+    sw_texture_pool_release(RLSW.texturePool);
+
+    if (!RLSW.framebuffer.externalColor) SW_FREE(RLSW.framebuffer.color);
+    SW_FREE(RLSW.framebuffer.depth);
+    SW_FREE(RLSW.framebuffer.hiz);
+    SW_FREE(RLSW.vertexCache.data);
+    SW_FREE(RLSW.edges.data);
+    SW_FREE(RLSW.edges.buckets);
+    SW_FREE(RLSW.loadedFramebuffers);
+    SW_FREE(RLSW.freeFramebufferIds);
+
+#if SW_ENABLE_CONTEXTS
+    SWcontext *owner = RLSW.owner;
     RLSW = (sw_context_t) { 0 };
+    RLSW.owner = owner;
+#else
+    RLSW = (sw_context_t) { 0 };
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+bool swInit(int w, int h)
+{
+#if SW_ENABLE_BINNING || SW_ENABLE_CONTEXTS
+    swCurrentContext = &swDefaultContext.state;
+#endif
+
+    return sw_context_init(&swDefaultContext, w, h, NULL);
+}
+
+void swClose(void)
+{
+#if SW_ENABLE_BINNING || SW_ENABLE_CONTEXTS
+    swCurrentContext = &swDefaultContext.state;
+#endif
+
+    sw_context_close();
+}
+
+// NOTE: The new context is not made current, texture objects are shared with 'shareContext' if provided
+SWcontext *swCreateContext(int w, int h, SWcontext *shareContext)
+{
+#if SW_ENABLE_CONTEXTS
+    SWcontext *context = SW_MALLOC(sizeof(SWcontext));
+    if (context == NULL)
+    {
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return NULL;
+    }
+
+    memset(context, 0, sizeof(SWcontext));
+
+    sw_texture_pool_t *sharedPool = (shareContext != NULL)? shareContext->state.texturePool : NULL;
+
+    // The context is initialized as the current one, then the calling thread context is restored
+    sw_context_t *previous = swCurrentContext;
+    swCurrentContext = &context->state;
+    bool result = sw_context_init(context, w, h, sharedPool);
+    swCurrentContext = previous;
+
+    if (!result)
+    {
+        SW_FREE(context);
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return NULL;
+    }
+
+    return context;
+#else
+    (void)w; (void)h; (void)shareContext;
+    RLSW.errCode = SW_INVALID_OPERATION;
+    return NULL;
+#endif
+}
+
+// NOTE: The context must not be current on another thread, the default context is closed with swClose()
+void swDestroyContext(SWcontext *context)
+{
+    if (context == NULL) return;
+
+    if (context == &swDefaultContext)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+#if SW_ENABLE_CONTEXTS
+    sw_context_t *previous = swCurrentContext;
+    swCurrentContext = &context->state;
+    sw_context_close();
+    swCurrentContext = (previous == &context->state)? &swDefaultContext.state : previous;
+
+    SW_FREE(context);
+#endif
+}
+
+// NOTE: Threads use the default context until another one is made current, NULL restores it
+bool swMakeCurrent(SWcontext *context)
+{
+#if SW_ENABLE_CONTEXTS
+    swCurrentContext = (context != NULL)? &context->state : &swDefaultContext.state;
+    return true;
+#else
+    if ((context != NULL) && (context != &swDefaultContext))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return false;
+    }
+
+    return true;
+#endif
+}
+
+SWcontext *swGetCurrentContext(void)
+{
+#if SW_ENABLE_CONTEXTS
+    return (RLSW.owner != NULL)? RLSW.owner : &swDefaultContext;
+#else
+    return &swDefaultContext;
+#endif
 }
 
 bool swResizeFramebuffer(int w, int h)
 {
+    // Only the main framebuffer can be resized, framebuffer objects follow their attachments
+    if (RLSW.currentFramebuffer != 0)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return false;
+    }
+
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    if (sw_bin_is_active())
+    {
+        sw_bin_flush();
+        if (!sw_framebuffer_resize(w, h)) return false;
+        return sw_bin_resize(w, h);
+    }
+#endif
+
     return sw_framebuffer_resize(w, h);
 }
 
 void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels)
 {
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     sw_pixelformat_t pFormat = sw_get_pixel_format(format, type);
 
     if (w <= 0)
@@ -3922,33 +7888,34 @@ void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type,
         return;
     }
 
-    if (w > RLSW.framebuffer.width) w = RLSW.framebuffer.width;
-    if (h > RLSW.framebuffer.height) h = RLSW.framebuffer.height;
+    x = sw_clampi(x, 0, RLSW.framebuffer.width);
+    y = sw_clampi(y, 0, RLSW.framebuffer.height);
 
-    x = sw_clampi(x, 0, w);
-    y = sw_clampi(y, 0, h);
+    if (w > RLSW.framebuffer.width - x) w = RLSW.framebuffer.width - x;
+    if (h > RLSW.framebuffer.height - y) h = RLSW.framebuffer.height - y;
+    if ((w <= 0) || (h <= 0)) return;
 
-    switch (pFormat)
+    // Destination rows are 'rowLength' pixels apart (GL_PACK_ROW_LENGTH), tightly packed by default
+    int rowLength = (RLSW.packRowLength > 0)? RLSW.packRowLength : w;
+
+    SW_STATS_TIMER_BEGIN();
+
+    if (!sw_framebuffer_copy_region(RLSW.framebuffer.color, RLSW.framebuffer.width, x, y, w, h, pFormat, rowLength, pixels))
     {
-        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_copy_to_GRAYALPHA(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: sw_framebuffer_copy_to_GRAYALPHA(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5: sw_framebuffer_copy_to_R5G6B5(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32: sw_framebuffer_copy_to_R32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32: sw_framebuffer_copy_to_R32G32B32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: sw_framebuffer_copy_to_R32G32B32A32(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16: sw_framebuffer_copy_to_R16(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16: sw_framebuffer_copy_to_R16G16B16(x, y, w, h, pixels); break;
-        case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_framebuffer_copy_to_R16G16B16A16(x, y, w, h, pixels); break;
-        default: RLSW.errCode = SW_INVALID_ENUM; break;
+        RLSW.errCode = SW_INVALID_ENUM;
     }
+
+    SW_STATS_TIMER_END(copyTime);
 }
 
 void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels)
 {
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     sw_pixelformat_t pFormat = sw_get_pixel_format(format, type);
 
     if (wSrc <= 0)
@@ -3969,6 +7936,8 @@ void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySr
     xSrc = sw_clampi(xSrc, 0, wSrc);
     ySrc = sw_clampi(ySrc, 0, hSrc);
 
+    SW_STATS_TIMER_BEGIN();
+
     switch (pFormat)
     {
         case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_blit_to_GRAYALPHA(xDst, yDst, wDst, hDst, xSrc, ySrc, wSrc, hSrc, pixels); break;
@@ -3986,18 +7955,198 @@ void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySr
         case SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: sw_framebuffer_blit_to_R16G16B16A16(xDst, yDst, wDst, hDst, xSrc, ySrc, wSrc, hSrc, pixels); break;
         default: RLSW.errCode = SW_INVALID_ENUM; break;
     }
+
+    SW_STATS_TIMER_END(copyTime);
+}
+
+// NOTE: The callback is always called once the presentation is over, even if nothing was written
+void swPresentFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels, SWpresentcallback callback, void *userData)
+{
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_ASYNC_PRESENT
+    sw_presenter_t *presenter = &RLSW_PRESENTER;
+
+    if (sw_present_start())
+    {
+    #if SW_ENABLE_BINNING
+        sw_bin_flush();
+    #endif
+
+        sw_pixelformat_t pFormat = sw_get_pixel_format(format, type);
+
+        if ((w <= 0) || (h <= 0))
+        {
+            RLSW.errCode = SW_INVALID_VALUE;
+            w = h = 0;
+        }
+        else if ((pFormat < SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (pFormat > SW_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
+        {
+            RLSW.errCode = SW_INVALID_ENUM;
+            w = h = 0;
+        }
+        else
+        {
+            x = sw_clampi(x, 0, RLSW.framebuffer.width);
+            y = sw_clampi(y, 0, RLSW.framebuffer.height);
+
+            if (w > RLSW.framebuffer.width - x) w = RLSW.framebuffer.width - x;
+            if (h > RLSW.framebuffer.height - y) h = RLSW.framebuffer.height - y;
+        }
+
+        // The previous frame snapshot and destination may still be in use
+        sw_present_wait();
+
+        if ((w <= 0) || (h <= 0))
+        {
+            if (callback != NULL) callback(userData);
+            return;
+        }
+
+        SW_STATS_TIMER_BEGIN();
+
+        if (w*h > presenter->allocSz)
+        {
+            void *newColor = SW_REALLOC(presenter->color, SW_COLOR_PIXEL_SIZE*w*h);
+            if (newColor == NULL)
+            {
+                RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+                if (callback != NULL) callback(userData);
+                return;
+            }
+
+            presenter->color = newColor;
+            presenter->allocSz = w*h;
+        }
+
+        // Only the snapshot is taken here, the conversion is done by the present thread
+        for (int iy = 0; iy < h; iy++)
+        {
+            memcpy(sw_framebuffer_get_color_addr(presenter->color, iy*w),
+                sw_framebuffer_get_color_addr(RLSW.framebuffer.color, (y + iy)*RLSW.framebuffer.width + x), SW_COLOR_PIXEL_SIZE*w);
+        }
+
+        SW_STATS_TIMER_END(copyTime);
+
+        presenter->width = w;
+        presenter->height = h;
+        presenter->format = pFormat;
+        presenter->rowLength = (RLSW.packRowLength > 0)? RLSW.packRowLength : w;
+        presenter->pixels = pixels;
+        presenter->callback = callback;
+        presenter->userData = userData;
+
+        sw_mutex_lock(&presenter->mutex);
+        presenter->pending = true;
+        sw_cond_signal(&presenter->startCond);
+        sw_mutex_unlock(&presenter->mutex);
+
+        return;
+    }
+#endif
+
+    swCopyFramebuffer(x, y, w, h, format, type, pixels);
+    if (callback != NULL) callback(userData);
+}
+
+void swWaitPresent(void)
+{
+#if SW_ENABLE_ASYNC_PRESENT
+    sw_present_wait();
+#endif
 }
 
 void *swGetColorBuffer(int *w, int *h)
 {
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     if (w) *w = RLSW.framebuffer.width;
     if (h) *h = RLSW.framebuffer.height;
 
     return RLSW.framebuffer.color;
 }
 
+// Render the main framebuffer into external memory, NULL goes back to an owned color buffer
+// NOTE: Memory must hold width*height pixels in the color buffer layout, rows tightly packed,
+// it is used until replaced, the framebuffer is resized or the context is closed
+bool swSetColorBuffer(void *pixels)
+{
+    // Only the main framebuffer storage can be replaced, framebuffer objects follow their attachments
+    if (RLSW.currentFramebuffer != 0)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return false;
+    }
+
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
+    if (pixels != NULL)
+    {
+        if (!RLSW.framebuffer.externalColor) SW_FREE(RLSW.framebuffer.color);
+
+        RLSW.framebuffer.color = pixels;
+        RLSW.framebuffer.externalColor = true;
+    }
+    else if (RLSW.framebuffer.externalColor)
+    {
+        void *color = SW_MALLOC(SW_COLOR_PIXEL_SIZE*RLSW.framebuffer.allocSz);
+        if (color == NULL)
+        {
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+            return false;
+        }
+
+        RLSW.framebuffer.color = color;
+        RLSW.framebuffer.externalColor = false;
+    }
+
+    // The content of the new color buffer is unknown
+    sw_framebuffer_reset_tracking();
+
+    return true;
+}
+
+bool swGetDirtyRect(int *x, int *y, int *w, int *h)
+{
+    const int *rect = RLSW.framebuffer.dirtyRect;
+    bool dirty = (rect[0] < rect[2]) && (rect[1] < rect[3]);
+
+    if (x) *x = dirty? rect[0] : 0;
+    if (y) *y = dirty? rect[1] : 0;
+    if (w) *w = dirty? rect[2] - rect[0] : 0;
+    if (h) *h = dirty? rect[3] - rect[1] : 0;
+
+    return dirty;
+}
+
+void swResetDirtyRect(void)
+{
+    sw_rect_set_empty(RLSW.framebuffer.dirtyRect);
+}
+
+void swFinish(void)
+{
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+}
+
 void swEnable(SWstate state)
 {
+    // Pending edges are anti-aliased with the raster bounds and depth test they were drawn with
+    if (((state == SW_SCISSOR_TEST) && !SW_STATE_CHECK(SW_STATE_SCISSOR_TEST)) ||
+        ((state == SW_DEPTH_TEST) && !SW_STATE_CHECK(SW_STATE_DEPTH_TEST))) sw_edge_list_resolve();
+
     switch (state)
     {
         case SW_SCISSOR_TEST: RLSW.stateFlags |= SW_STATE_SCISSOR_TEST; break;
@@ -4005,12 +8154,18 @@ void swEnable(SWstate state)
         case SW_DEPTH_TEST: RLSW.stateFlags |= SW_STATE_DEPTH_TEST; break;
         case SW_CULL_FACE: RLSW.stateFlags |= SW_STATE_CULL_FACE; break;
         case SW_BLEND: RLSW.stateFlags |= SW_STATE_BLEND; break;
+        case SW_PARTIAL_CLEAR: RLSW.stateFlags |= SW_STATE_PARTIAL_CLEAR; break;
+        case SW_MULTISAMPLE: RLSW.stateFlags |= SW_STATE_MULTISAMPLE; break;
         default: RLSW.errCode = SW_INVALID_ENUM; break;
     }
 }
 
 void swDisable(SWstate state)
 {
+    if (((state == SW_SCISSOR_TEST) && SW_STATE_CHECK(SW_STATE_SCISSOR_TEST)) ||
+        ((state == SW_DEPTH_TEST) && SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) ||
+        ((state == SW_MULTISAMPLE) && SW_STATE_CHECK(SW_STATE_MULTISAMPLE))) sw_edge_list_resolve();
+
     switch (state)
     {
         case SW_SCISSOR_TEST: RLSW.stateFlags &= ~SW_STATE_SCISSOR_TEST; break;
@@ -4018,6 +8173,27 @@ void swDisable(SWstate state)
         case SW_DEPTH_TEST: RLSW.stateFlags &= ~SW_STATE_DEPTH_TEST; break;
         case SW_CULL_FACE: RLSW.stateFlags &= ~SW_STATE_CULL_FACE; break;
         case SW_BLEND: RLSW.stateFlags &= ~SW_STATE_BLEND; break;
+        case SW_PARTIAL_CLEAR: RLSW.stateFlags &= ~SW_STATE_PARTIAL_CLEAR; break;
+        case SW_MULTISAMPLE: RLSW.stateFlags &= ~SW_STATE_MULTISAMPLE; break;
+        default: RLSW.errCode = SW_INVALID_ENUM; break;
+    }
+}
+
+void swPixelStorei(SWpixelstore pname, int param)
+{
+    switch (pname)
+    {
+        case SW_PACK_ROW_LENGTH:
+        {
+            if (param < 0) RLSW.errCode = SW_INVALID_VALUE;
+            else RLSW.packRowLength = param;
+        } break;
+        case SW_PACK_ALIGNMENT:
+        case SW_UNPACK_ALIGNMENT:
+        {
+            // NOTE: Rows are always tightly packed, only the row length is configurable
+            if ((param != 1) && (param != 2) && (param != 4) && (param != 8)) RLSW.errCode = SW_INVALID_VALUE;
+        } break;
         default: RLSW.errCode = SW_INVALID_ENUM; break;
     }
 }
@@ -4029,6 +8205,7 @@ void swGetIntegerv(SWget name, int *v)
         case SW_MODELVIEW_STACK_DEPTH: *v = SW_MODELVIEW_STACK_DEPTH; break;
         case SW_PROJECTION_STACK_DEPTH: *v = SW_PROJECTION_STACK_DEPTH; break;
         case SW_TEXTURE_STACK_DEPTH: *v = SW_TEXTURE_STACK_DEPTH; break;
+        case SW_FRAMEBUFFER_BINDING: *v = (int)RLSW.currentFramebuffer; break;
         default: RLSW.errCode = SW_INVALID_ENUM; break;
     }
 }
@@ -4106,6 +8283,31 @@ SWerrcode swGetError(void)
     return ret;
 }
 
+void swGetStats(SWstats *stats)
+{
+    if (stats == NULL) return;
+
+#if SW_ENABLE_STATS
+    // Counters of the recorded primitives are only complete once rasterized
+    #if SW_ENABLE_BINNING
+        sw_bin_flush();
+    #endif
+    *stats = RLSW.stats;
+#else
+    *stats = (SWstats) { 0 };
+#endif
+}
+
+void swResetStats(void)
+{
+#if SW_ENABLE_STATS
+    #if SW_ENABLE_BINNING
+        sw_bin_flush();
+    #endif
+    RLSW.stats = (SWstats) { 0 };
+#endif
+}
+
 void swViewport(int x, int y, int width, int height)
 {
     if ((width < 0) || (height < 0))
@@ -4114,6 +8316,8 @@ void swViewport(int x, int y, int width, int height)
         return;
     }
 
+    sw_edge_list_resolve();
+
     RLSW.vpSize[0] = width;
     RLSW.vpSize[1] = height;
 
@@ -4137,6 +8341,8 @@ void swScissor(int x, int y, int width, int height)
         return;
     }
 
+    sw_edge_list_resolve();
+
     RLSW.scMin[0] = sw_clampi(x, 0, RLSW.framebuffer.width - 1);
     RLSW.scMin[1] = sw_clampi(y, 0, RLSW.framebuffer.height - 1);
     RLSW.scMax[0] = sw_clampi(x + width, 0, RLSW.framebuffer.width - 1);
@@ -4144,8 +8350,17 @@ void swScissor(int x, int y, int width, int height)
 
     RLSW.scClipMin[0] = (2.0f*(float)RLSW.scMin[0]/(float)RLSW.vpSize[0]) - 1.0f;
     RLSW.scClipMax[0] = (2.0f*(float)RLSW.scMax[0]/(float)RLSW.vpSize[0]) - 1.0f;
-    RLSW.scClipMax[1] = 1.0f - (2.0f*(float)RLSW.scMin[1]/(float)RLSW.vpSize[1]);
-    RLSW.scClipMin[1] = 1.0f - (2.0f*(float)RLSW.scMax[1]/(float)RLSW.vpSize[1]);
+
+    if (RLSW.framebuffer.bottomUp)
+    {
+        RLSW.scClipMin[1] = (2.0f*(float)RLSW.scMin[1]/(float)RLSW.vpSize[1]) - 1.0f;
+        RLSW.scClipMax[1] = (2.0f*(float)RLSW.scMax[1]/(float)RLSW.vpSize[1]) - 1.0f;
+    }
+    else
+    {
+        RLSW.scClipMax[1] = 1.0f - (2.0f*(float)RLSW.scMin[1]/(float)RLSW.vpSize[1]);
+        RLSW.scClipMin[1] = 1.0f - (2.0f*(float)RLSW.scMax[1]/(float)RLSW.vpSize[1]);
+    }
 }
 
 void swClearColor(float r, float g, float b, float a)
@@ -4158,20 +8373,59 @@ void swClearColor(float r, float g, float b, float a)
 
 void swClear(uint32_t bitmask)
 {
-    int size = RLSW.framebuffer.width*RLSW.framebuffer.height;
+    // Incomplete framebuffer objects have nothing to clear
+    if (RLSW.framebuffer.color == NULL) return;
+
+    sw_edge_list_resolve();
 
-    if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT))
-    {
-        sw_framebuffer_fill(RLSW.framebuffer.color, RLSW.framebuffer.depth,size, RLSW.clearColor, RLSW.clearDepth);
-    }
-    else if (bitmask & (SW_COLOR_BUFFER_BIT))
+    sw_framebuffer_t *fb = &RLSW.framebuffer;
+    uint32_t mask = bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT);
+
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
     {
-        sw_framebuffer_fill_color(RLSW.framebuffer.color, size, RLSW.clearColor);
+        // The cleared region may now differ from the last full clear
+        sw_framebuffer_mark(RLSW.scMin[0], RLSW.scMin[1], RLSW.scMax[0] + 1, RLSW.scMax[1] + 1);
+        sw_framebuffer_clear(bitmask);
+        return;
     }
-    else if (bitmask & SW_DEPTH_BUFFER_BIT)
+
+    bool sameClear = (mask != 0) && (mask == fb->clearedMask) && (RLSW.clearDepth == fb->clearedDepth) &&
+                     (RLSW.clearColor[0] == fb->clearedColor[0]) && (RLSW.clearColor[1] == fb->clearedColor[1]) &&
+                     (RLSW.clearColor[2] == fb->clearedColor[2]) && (RLSW.clearColor[3] == fb->clearedColor[3]);
+
+    if (sameClear && (RLSW.stateFlags & SW_STATE_PARTIAL_CLEAR))
     {
-        sw_framebuffer_fill_depth(RLSW.framebuffer.depth, size, RLSW.clearDepth);
+        // Only the region modified since the last clear differs from the cleared values,
+        // it is cleared through the scissor rectangle, recorded along with binned commands
+        int *used = fb->usedRect;
+        if ((used[0] >= used[2]) || (used[1] >= used[3])) return;
+
+        int scMin[2] = { RLSW.scMin[0], RLSW.scMin[1] };
+        int scMax[2] = { RLSW.scMax[0], RLSW.scMax[1] };
+
+        RLSW.scMin[0] = used[0], RLSW.scMin[1] = used[1];
+        RLSW.scMax[0] = used[2] - 1, RLSW.scMax[1] = used[3] - 1;
+        RLSW.stateFlags |= SW_STATE_SCISSOR_TEST;
+
+        sw_framebuffer_clear(bitmask);
+
+        RLSW.scMin[0] = scMin[0], RLSW.scMin[1] = scMin[1];
+        RLSW.scMax[0] = scMax[0], RLSW.scMax[1] = scMax[1];
+        RLSW.stateFlags &= ~SW_STATE_SCISSOR_TEST;
+
+        sw_rect_merge(fb->dirtyRect, used[0], used[1], used[2], used[3]);
+        sw_rect_set_empty(fb->usedRect);
+        return;
     }
+
+    sw_framebuffer_clear(bitmask);
+    if (mask & SW_COLOR_BUFFER_BIT) sw_rect_merge(fb->dirtyRect, 0, 0, fb->width, fb->height);
+
+    // The cleared buffers hold uniform values again, only those are tracked from now on
+    fb->clearedMask = mask;
+    fb->clearedDepth = RLSW.clearDepth;
+    for (int i = 0; i < 4; i++) fb->clearedColor[i] = RLSW.clearColor[i];
+    sw_rect_set_empty(fb->usedRect);
 }
 
 void swBlendFunc(SWfactor sfactor, SWfactor dfactor)
@@ -4624,14 +8878,7 @@ void swVertex4fv(const float *v)
     // Immediate rendering of the primitive if the required number is reached
     if (RLSW.vertexCounter == RLSW.reqVertices)
     {
-        switch (RLSW.polyMode)
-        {
-            case SW_FILL: sw_poly_fill_render(); break;
-            case SW_LINE: sw_poly_line_render(); break;
-            case SW_POINT: sw_poly_point_render(); break;
-            default: break;
-        }
-
+        sw_poly_render();
         RLSW.vertexCounter = 0;
     }
 }
@@ -4753,18 +9000,71 @@ void swDrawArrays(SWdraw mode, int offset, int count)
         return;
     }
 
+    if ((offset < 0) || (count < 0))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    int batchSize = (count < SW_VERTEX_BATCH_SIZE)? count : SW_VERTEX_BATCH_SIZE;
+    if (!sw_vertex_cache_reserve(batchSize)) return;
+
     swBegin(mode);
+    if (RLSW.drawMode == 0) return;  // Invalid mode, error already set
+
+    // NOTE: The batch size is a multiple of the vertices of every primitive, so no
+    // primitive is split between two batches
+    for (int first = 0; first < count; first += SW_VERTEX_BATCH_SIZE)
     {
-        swTexCoord2f(0.0f, 0.0f);
-        swColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+        int n = count - first;
+        if (n > SW_VERTEX_BATCH_SIZE) n = SW_VERTEX_BATCH_SIZE;
 
-        for (int i = offset; i < count; i++)
-        {
-            if (RLSW.array.texcoords) swTexCoord2fv(RLSW.array.texcoords + 2*i);
-            if (RLSW.array.colors) swColor4ubv(RLSW.array.colors + 4*i);
-            swVertex3fv(RLSW.array.positions + 3*i);
-        }
+        sw_vertex_cache_transform(offset + first, n);
+        for (int i = 0; i < n; i++) sw_vertex_cache_emit(i);
+    }
+
+    swEnd();
+}
+
+void swDrawElements(SWdraw mode, int count, SWtype type, const void *indices)
+{
+    if (RLSW.array.positions == 0)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    if ((type != SW_UNSIGNED_BYTE) && (type != SW_UNSIGNED_SHORT) && (type != SW_UNSIGNED_INT))
+    {
+        RLSW.errCode = SW_INVALID_ENUM;
+        return;
+    }
+
+    if (count < 0)
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    if ((count == 0) || (indices == NULL)) return;
+
+    // Only the range of vertices referenced by the indices is transformed
+    uint32_t minIndex = UINT32_MAX, maxIndex = 0;
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t index = sw_get_index(indices, type, i);
+        if (index < minIndex) minIndex = index;
+        if (index > maxIndex) maxIndex = index;
     }
+
+    if (!sw_vertex_cache_reserve((int)(maxIndex - minIndex + 1))) return;
+
+    swBegin(mode);
+    if (RLSW.drawMode == 0) return;  // Invalid mode, error already set
+
+    sw_vertex_cache_transform((int)minIndex, (int)(maxIndex - minIndex + 1));
+    for (int i = 0; i < count; i++) sw_vertex_cache_emit((int)(sw_get_index(indices, type, i) - minIndex));
+
     swEnd();
 }
 
@@ -4772,27 +9072,37 @@ void swGenTextures(int count, uint32_t *textures)
 {
     if ((count == 0) || (textures == NULL)) return;
 
+    sw_texture_pool_t *pool = RLSW.texturePool;
+
+    SW_TEXTURE_POOL_LOCK();
+
     for (int i = 0; i < count; i++)
     {
-        if (RLSW.loadedTextureCount >= SW_MAX_TEXTURES)
+        if ((pool->freeIdCount == 0) && (pool->textureCount >= SW_MAX_TEXTURES))
         {
             RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory, not really stack overflow
-            return;
+            break;
         }
 
         uint32_t id = 0;
-        if (RLSW.freeTextureIdCount > 0) id = RLSW.freeTextureIds[--RLSW.freeTextureIdCount];
-        else id = RLSW.loadedTextureCount++;
+        if (pool->freeIdCount > 0) id = pool->freeIds[--pool->freeIdCount];
+        else id = pool->textureCount++;
 
-        RLSW.loadedTextures[id] = RLSW.loadedTextures[0];
+        pool->textures[id] = pool->textures[0];
         textures[i] = id;
     }
+
+    SW_TEXTURE_POOL_UNLOCK();
 }
 
 void swDeleteTextures(int count, uint32_t *textures)
 {
     if ((count == 0) || (textures == NULL)) return;
 
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     for (int i = 0; i < count; i++)
     {
         if (!sw_is_texture_valid(textures[i]))
@@ -4801,21 +9111,49 @@ void swDeleteTextures(int count, uint32_t *textures)
             continue;
         }
 
+        // Only the framebuffer objects of the current context can be detached
+        if (sw_fbo_is_texture_attached_elsewhere(textures[i]))
+        {
+            RLSW.errCode = SW_INVALID_OPERATION;
+            continue;
+        }
+
+        // Deleted textures are detached from the framebuffer objects
+        for (int j = 1; j < RLSW.loadedFramebufferCount; j++)
+        {
+            sw_fbo_t *fbo = &RLSW.loadedFramebuffers[j];
+            if (fbo->colorTexture == textures[i]) { fbo->colorTexture = 0; sw_fbo_detach_texture(textures[i]); }
+            if (fbo->depthTexture == textures[i]) { fbo->depthTexture = 0; sw_fbo_detach_texture(textures[i]); }
+        }
+
         if (RLSW.loadedTextures[textures[i]].copy)
         {
             SW_FREE(RLSW.loadedTextures[textures[i]].pixels.ptr);
         }
 
+        sw_texture_free_mipmaps(&RLSW.loadedTextures[textures[i]]);
+
         RLSW.loadedTextures[textures[i]].pixels.cptr = NULL;
-        RLSW.freeTextureIds[RLSW.freeTextureIdCount++] = textures[i];
+
+        SW_TEXTURE_POOL_LOCK();
+        RLSW.texturePool->freeIds[RLSW.texturePool->freeIdCount++] = textures[i];
+        SW_TEXTURE_POOL_UNLOCK();
     }
+
+    // The bound framebuffer object may have lost its attachments
+    if (RLSW.currentFramebuffer != 0) sw_fbo_bind_target();
 }
 
 void swTexImage2D(int width, int height, SWformat format, SWtype type, bool copy, const void *data)
+{
+    swTexImage2DLevel(0, width, height, format, type, copy, data);
+}
+
+void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, bool copy, const void *data)
 {
     uint32_t id = RLSW.currentTexture;
 
-    if (!sw_is_texture_valid(id))
+    if (!sw_is_texture_valid(id) || (level < 0) || ((id == 0) && (level > 0)))
     {
         RLSW.errCode = SW_INVALID_VALUE;
         return;
@@ -4829,35 +9167,135 @@ void swTexImage2D(int width, int height, SWformat format, SWtype type, bool copy
         return;
     }
 
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     sw_texture_t *texture = &RLSW.loadedTextures[id];
 
-    if (copy)
+    // Redefining the base level discards the previous image and its mipmaps
+    if (level == 0)
     {
-        int bytes = sw_get_pixel_bytes(pixelFormat);
-        int size = bytes*width*height;
-        texture->pixels.ptr = SW_MALLOC(size);
+        sw_texture_free_mipmaps(texture);
+        if (texture->copy) SW_FREE(texture->pixels.ptr);
+        texture->copy = false;
 
-        if (texture->pixels.ptr == NULL)
+        sw_texture_set_image(texture, width, height, pixelFormat, copy, data);
+        sw_fbo_texture_changed(id);
+        return;
+    }
+
+    // Mipmap levels are defined in order, with the dimensions expected from the base level
+    int levelWidth = texture->width >> level;
+    int levelHeight = texture->height >> level;
+
+    if ((level > texture->mipmapCount) || (level >= sw_texture_get_max_levels(texture->width, texture->height)) ||
+        (width != ((levelWidth > 0)? levelWidth : 1)) || (height != ((levelHeight > 0)? levelHeight : 1)))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    if (texture->mipmaps == NULL)
+    {
+        int count = sw_texture_get_max_levels(texture->width, texture->height) - 1;
+        texture->mipmaps = SW_MALLOC(count*sizeof(sw_texture_t));
+
+        if (texture->mipmaps == NULL)
         {
-            RLSW.errCode = SW_STACK_OVERFLOW; // WARING: Out of memory...
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
             return;
         }
+    }
 
-        for (int i = 0; i < size; i++)
+    if ((level < texture->mipmapCount) && texture->mipmaps[level - 1].copy)
+    {
+        SW_FREE(texture->mipmaps[level - 1].pixels.ptr);
+    }
+
+    sw_texture_t *mipmap = sw_texture_init_level(texture, level);
+
+    if (!sw_texture_set_image(mipmap, width, height, pixelFormat, copy, data))
+    {
+        // Keep the chain contiguous, the levels following the failed one are discarded
+        for (int i = level; i < texture->mipmapCount - 1; i++)
         {
-            ((uint8_t *)texture->pixels.ptr)[i] = ((uint8_t *)data)[i];
+            if (texture->mipmaps[i].copy) SW_FREE(texture->mipmaps[i].pixels.ptr);
         }
+
+        if (level < texture->mipmapCount) texture->mipmapCount = level;
+        return;
     }
-    else texture->pixels.cptr = data;
 
-    texture->width = width;
-    texture->height = height;
-    texture->wMinus1 = width - 1;
-    texture->hMinus1 = height - 1;
-    texture->format = pixelFormat;
-    texture->tx = 1.0f/width;
-    texture->ty = 1.0f/height;
-    texture->copy = copy;
+    if (level == texture->mipmapCount) texture->mipmapCount++;
+}
+
+void swGenerateMipmap(void)
+{
+    uint32_t id = RLSW.currentTexture;
+
+    if (!sw_is_texture_valid(id) || (id == 0) || (RLSW.loadedTextures[id].pixels.cptr == NULL))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
+    sw_texture_t *texture = &RLSW.loadedTextures[id];
+    int maxLevels = sw_texture_get_max_levels(texture->width, texture->height);
+
+    sw_texture_free_mipmaps(texture);
+    if (maxLevels == 1) return;
+
+    texture->mipmaps = SW_MALLOC((maxLevels - 1)*sizeof(sw_texture_t));
+
+    if (texture->mipmaps == NULL)
+    {
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return;
+    }
+
+    // Each level is filtered from the previous one, generated levels are stored as RGBA8
+    const sw_texture_t *src = texture;
+
+    for (int level = 1; level < maxLevels; level++)
+    {
+        int width = (src->width > 1)? src->width/2 : 1;
+        int height = (src->height > 1)? src->height/2 : 1;
+
+        uint8_t *pixels = SW_MALLOC(4*width*height);
+
+        if (pixels == NULL)
+        {
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+            return;
+        }
+
+        sw_texture_downsample_rgba8(pixels, width, height, src);
+
+        sw_texture_t *mipmap = sw_texture_init_level(texture, level);
+        sw_texture_set_image(mipmap, width, height, SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false, pixels);
+        mipmap->copy = true;    // The level owns the generated pixels
+
+        if (SW_TEXTURE_TILED)
+        {
+            uint8_t *tiledPixels = SW_MALLOC(4*16*mipmap->tileStride*((height + 3)/4));
+
+            if (tiledPixels != NULL)
+            {
+                sw_texture_store(tiledPixels, pixels, width, height, SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, true);
+                SW_FREE(pixels);
+                mipmap->pixels.ptr = tiledPixels;
+                mipmap->tiled = true;
+            }
+        }
+
+        texture->mipmapCount++;
+        src = mipmap;
+    }
 }
 
 void swTexParameteri(int param, int value)
@@ -4870,13 +9308,17 @@ void swTexParameteri(int param, int value)
         return;
     }
 
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
     sw_texture_t *texture = &RLSW.loadedTextures[id];
 
     switch (param)
     {
         case SW_TEXTURE_MIN_FILTER:
         {
-            if (!sw_is_texture_filter_valid(value))
+            if (!sw_is_texture_min_filter_valid(value))
             {
                 RLSW.errCode = SW_INVALID_ENUM;
                 return;
@@ -4903,6 +9345,7 @@ void swTexParameteri(int param, int value)
             }
 
             texture->sWrap = value;
+            for (int i = 0; i < texture->mipmapCount - 1; i++) texture->mipmaps[i].sWrap = value;
         } break;
         case SW_TEXTURE_WRAP_T:
         {
@@ -4913,6 +9356,7 @@ void swTexParameteri(int param, int value)
             }
 
             texture->tWrap = value;
+            for (int i = 0; i < texture->mipmapCount - 1; i++) texture->mipmaps[i].tWrap = value;
         } break;
         default: RLSW.errCode = SW_INVALID_ENUM; break;
     }
@@ -4935,4 +9379,173 @@ void swBindTexture(uint32_t id)
     RLSW.currentTexture = id;
 }
 
+void swGenFramebuffers(int count, uint32_t *framebuffers)
+{
+    if ((count == 0) || (framebuffers == NULL)) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((RLSW.freeFramebufferIdCount == 0) && (RLSW.loadedFramebufferCount >= SW_MAX_FRAMEBUFFERS))
+        {
+            RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory, not really stack overflow
+            return;
+        }
+
+        uint32_t id = 0;
+        if (RLSW.freeFramebufferIdCount > 0) id = RLSW.freeFramebufferIds[--RLSW.freeFramebufferIdCount];
+        else id = RLSW.loadedFramebufferCount++;
+
+        RLSW.loadedFramebuffers[id] = (sw_fbo_t) { 0 };
+        RLSW.loadedFramebuffers[id].generated = true;
+        framebuffers[i] = id;
+    }
+}
+
+void swDeleteFramebuffers(int count, uint32_t *framebuffers)
+{
+    if ((count == 0) || (framebuffers == NULL)) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (framebuffers[i] == 0) continue;     // Silently ignored, as in OpenGL
+
+        if (!sw_is_framebuffer_valid(framebuffers[i]))
+        {
+            RLSW.errCode = SW_INVALID_VALUE;
+            continue;
+        }
+
+        // Deleting the bound framebuffer object reverts to the main framebuffer
+        if (framebuffers[i] == RLSW.currentFramebuffer) swBindFramebuffer(0);
+
+        sw_fbo_t *fbo = &RLSW.loadedFramebuffers[framebuffers[i]];
+        sw_fbo_detach_texture(fbo->colorTexture);
+        sw_fbo_detach_texture(fbo->depthTexture);
+        SW_FREE(fbo->depth);
+        SW_FREE(fbo->hiz);
+        *fbo = (sw_fbo_t) { 0 };
+
+        RLSW.freeFramebufferIds[RLSW.freeFramebufferIdCount++] = framebuffers[i];
+    }
+}
+
+void swBindFramebuffer(uint32_t id)
+{
+    if ((id != 0) && !sw_is_framebuffer_valid(id))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    if (id == RLSW.currentFramebuffer) return;
+
+    // Edges are only recorded for the main framebuffer
+    sw_edge_list_resolve();
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
+    // The main framebuffer is kept aside while rendering into framebuffer objects
+    if (RLSW.currentFramebuffer == 0) RLSW.mainFramebuffer = RLSW.framebuffer;
+    else
+    {
+        sw_fbo_t *fbo = &RLSW.loadedFramebuffers[RLSW.currentFramebuffer];
+        fbo->hiz = RLSW.framebuffer.hiz;
+        fbo->hizAllocSz = RLSW.framebuffer.hizAllocSz;
+    }
+
+    RLSW.currentFramebuffer = id;
+
+    if (id == 0)
+    {
+        RLSW.framebuffer = RLSW.mainFramebuffer;
+        RLSW.mainFramebuffer = (sw_framebuffer_t) { 0 };
+
+        RLSW.rasterMin[0] = RLSW.rasterMin[1] = 0;
+        RLSW.rasterMax[0] = RLSW.framebuffer.width;
+        RLSW.rasterMax[1] = RLSW.framebuffer.height;
+    }
+    else sw_fbo_bind_target();
+
+    // Viewport and scissor bounds depend on the framebuffer size and orientation
+    swViewport(RLSW.vpCenter[0] - RLSW.vpHalfSize[0], RLSW.vpCenter[1] - RLSW.vpHalfSize[1], RLSW.vpSize[0], RLSW.vpSize[1]);
+    swScissor(RLSW.scMin[0], RLSW.scMin[1], RLSW.scMax[0] - RLSW.scMin[0], RLSW.scMax[1] - RLSW.scMin[1]);
+}
+
+void swFramebufferTexture2D(SWattachment attachment, uint32_t texture)
+{
+    if (RLSW.currentFramebuffer == 0)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    if ((attachment != SW_COLOR_ATTACHMENT) && (attachment != SW_DEPTH_ATTACHMENT))
+    {
+        RLSW.errCode = SW_INVALID_ENUM;
+        return;
+    }
+
+    if ((texture != 0) && !sw_is_texture_generated(texture))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+#if SW_ENABLE_BINNING
+    sw_bin_flush();
+#endif
+
+    sw_fbo_t *fbo = &RLSW.loadedFramebuffers[RLSW.currentFramebuffer];
+    uint32_t *attached = (attachment == SW_COLOR_ATTACHMENT)? &fbo->colorTexture : &fbo->depthTexture;
+
+    if (texture != *attached)
+    {
+        if (!sw_fbo_attach_texture(texture))
+        {
+            RLSW.errCode = SW_INVALID_OPERATION;
+            return;
+        }
+
+        sw_fbo_detach_texture(*attached);
+        *attached = texture;
+    }
+
+    sw_fbo_bind_target();
+}
+
+SWfbstatus swCheckFramebufferStatus(void)
+{
+    if (RLSW.currentFramebuffer == 0) return SW_FRAMEBUFFER_COMPLETE;
+
+    return sw_fbo_get_status(&RLSW.loadedFramebuffers[RLSW.currentFramebuffer]);
+}
+
+void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWattachget pname, int *params)
+{
+    if (RLSW.currentFramebuffer == 0)
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    const sw_fbo_t *fbo = &RLSW.loadedFramebuffers[RLSW.currentFramebuffer];
+    uint32_t texture = 0;
+
+    switch (attachment)
+    {
+        case SW_COLOR_ATTACHMENT: texture = fbo->colorTexture; break;
+        case SW_DEPTH_ATTACHMENT: texture = fbo->depthTexture; break;
+        default: RLSW.errCode = SW_INVALID_ENUM; return;
+    }
+
+    switch (pname)
+    {
+        case SW_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE: *params = (texture != 0)? SW_TEXTURE : 0; break;
+        case SW_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME: *params = (int)texture; break;
+        default: RLSW.errCode = SW_INVALID_ENUM; break;
+    }
+}
+
 #endif // RLSW_IMPLEMENTATION
@@ -105,6 +105,9 @@ typedef struct {
     SDL_JoystickID gamepadId[MAX_GAMEPADS]; // Joystick instance ids, they do not start from 0
     SDL_Cursor *cursor;
     bool cursorRelative;
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    SDL_Surface *surface;               // Window surface updated on last swap, a new one requires a full update
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -1234,8 +1237,17 @@ void SwapScreenBuffer(void)
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     // NOTE: We use a preprocessor condition here because `rlCopyFramebuffer` is only declared for software rendering
     SDL_Surface *surface = SDL_GetWindowSurface(platform.window);
-    rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pixels);
-    SDL_UpdateWindowSurface(platform.window);
+    SDL_Rect rect = { 0, 0, CORE.Window.render.width, CORE.Window.render.height };
+
+    // Only the framebuffer region modified since last swap is copied and presented
+    if ((surface == platform.surface) && !rlGetFramebufferDirtyRect(&rect.x, &rect.y, &rect.w, &rect.h)) return;
+
+    rlCopyFramebufferRegion(rect.x, rect.y, rect.w, rect.h, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pitch/4,
+        (unsigned char *)surface->pixels + rect.y*surface->pitch + rect.x*4);
+    SDL_UpdateWindowSurfaceRects(platform.window, &rect, 1);
+
+    rlResetFramebufferDirtyRect();
+    platform.surface = surface;
 #else
     SDL_GL_SwapWindow(platform.window);
 #endif
@@ -75,6 +75,8 @@
 #else
     #include <sys/mman.h>       // For mmap when copying to the dumb buffer
     #include <errno.h>          // For the conversion of certain error messages
+
+    #define MAX_DUMB_BUFFERS    3   // Dumb buffers rendered into directly and page flipped (zero-copy)
 #endif
 
 // NOTE: DRM cache enables triple buffered DRM caching
@@ -119,7 +121,15 @@ typedef struct {
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
 #else
-    uint32_t prevDumbHandle;            // Handle to the previous dumb buffer (during frame swapping)
+    uint32_t dumbHandle[MAX_DUMB_BUFFERS]; // Handles to the dumb buffers scanned out (software rendering)
+    uint32_t dumbFB[MAX_DUMB_BUFFERS];  // DRM framebuffers of the dumb buffers
+    void *dumbBuffer[MAX_DUMB_BUFFERS]; // Dumb buffers mapped memory
+    int dumbBufferCount;                // Number of dumb buffers, a single one is updated in place by copies
+    uint64_t dumbBufferSize;            // Dumb buffer mapped memory size in bytes
+    uint32_t dumbBufferPitch;           // Dumb buffer row size in bytes
+    int dumbBack;                       // Dumb buffer rendered into directly by rlsw (zero-copy)
+    bool dumbFlipPending;               // Page flip to the last rendered dumb buffer not completed yet
+    drmModeClip dumbClip;               // Dumb buffer region updated by the last presented frame
 #endif
 
     // Keyboard data
@@ -265,6 +275,14 @@ static int FindMatchingConnectorMode(const drmModeConnector *connector, const dr
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
 static int FindNearestConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);    // Search the nearest matching DRM connector mode in connector's list
 
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+static bool CreateDumbBuffer(int index, uint width, uint height, uint bpp, uint depth); // Create a dumb buffer, its DRM framebuffer and map it
+static void DestroyDumbBuffer(int index);       // Unmap and destroy a dumb buffer and its DRM framebuffer
+static void DumbBufferPresentHandler(void *data);   // Notify the dumb buffer region written by rlsw
+static void DumbBufferFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data); // Page flip completion handler
+static void WaitDumbBufferFlip(void);           // Wait for the pending dumb buffer page flip
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -839,7 +857,8 @@ void SwapScreenBuffer(void)
     uint32_t height = mode->vdisplay;
 
     // Dumb buffers use a fixed format based on bpp
-#if SW_COLOR_BUFFER_BITS == 24
+    // NOTE: With a 32-bit color buffer stored in BGRA order (default), XRGB8888 copies are plain row copies
+#if (SW_COLOR_BUFFER_BITS == 24) || (SW_COLOR_BUFFER_BITS == 32)
     const uint32_t bpp = 32;    // 32 bits per pixel (XRGB8888 format)
     const uint32_t depth = 24;  // Color depth, here only 24 bits, alpha is not used
 #else
@@ -848,163 +867,148 @@ void SwapScreenBuffer(void)
     const uint32_t depth = SW_COLOR_BUFFER_BITS;
 #endif
 
-    // Create a dumb buffer for software rendering
-    struct drm_mode_create_dumb creq = { 0 };
-    creq.width = width;
-    creq.height = height;
-    creq.bpp = bpp;
-
-    int result = drmIoctl(platform.fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq);
-    if (result < 0)
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to create dumb buffer: %s", strerror(errno));
-        return;
-    }
-
-    // Create framebuffer with the correct format
-    uint32_t fb = 0;
-    result = drmModeAddFB(platform.fd, width, height, depth, bpp, creq.pitch, creq.handle, &fb);
-    if (result != 0) 
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d (%s)", result, strerror(errno));
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
-
-    // Map the dumb buffer to copy our software rendered buffer
-    struct drm_mode_map_dumb mreq = { 0 };
-    mreq.handle = creq.handle;
-    result = drmIoctl(platform.fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
-    if (result != 0)
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to map dumb buffer: %s", strerror(errno));
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
-
-    // Map the buffer into userspace
-    void *dumbBuffer = mmap(0, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, platform.fd, mreq.offset);
-    if (dumbBuffer == MAP_FAILED)
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to mmap dumb buffer: %s", strerror(errno));
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
-
-    // Copy the software rendered buffer to the dumb buffer with scaling if needed
-    if (bufferWidth == width && bufferHeight == height)
+    // Create and set the scanout dumb buffers, only once
+    bool fullUpdate = false;
+    if (platform.dumbBufferCount == 0)
     {
-        // Direct copy if sizes match
-        swCopyFramebuffer(0, 0, bufferWidth, bufferHeight, SW_RGBA, SW_UNSIGNED_BYTE, dumbBuffer);
-    }
-    else
-    {
-        // Scale the software buffer to match the display mode
-        swBlitFramebuffer(0, 0, width, height, 0, 0, bufferWidth, bufferHeight, SW_RGBA, SW_UNSIGNED_BYTE, dumbBuffer);
-    }
-
-    // Unmap the buffer
-    munmap(dumbBuffer, creq.size);
+        if (!CreateDumbBuffer(0, width, height, bpp, depth)) return;
+        platform.dumbBufferCount = 1;
 
-    // Find a CRTC compatible with the connector
-    uint32_t crtcId = 0;
-    if (platform.crtc) crtcId = platform.crtc->crtc_id;
-    else
-    {
-        // Find a CRTC that's compatible with this connector
-        drmModeRes *res = drmModeGetResources(platform.fd);
-        if (!res)
+    #if (SW_COLOR_BUFFER_BITS == 32) && SW_COLOR_BUFFER_BGRA
+        // The color buffer layout matches XRGB8888: with tightly packed rows, rlsw renders directly into
+        // the dumb buffers, which are page flipped instead of being updated with a copy of the frame
+        // NOTE: Triple buffering, the dumb buffer rendered into is neither scanned out nor waiting for a flip
+        if ((bufferWidth == width) && (bufferHeight == height) && (platform.dumbBufferPitch == width*4))
         {
-            TRACELOG(LOG_ERROR, "DISPLAY: Failed to get DRM resources");
-            drmModeRmFB(platform.fd, fb);
-            struct drm_mode_destroy_dumb dreq = {0};
-            dreq.handle = creq.handle;
-            drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-            return;
-        }
-
-        // Check which CRTCs are compatible with this connector
-        drmModeEncoder *encoder = NULL;
-        if (platform.connector->encoder_id) encoder = drmModeGetEncoder(platform.fd, platform.connector->encoder_id);
+            while ((platform.dumbBufferCount < MAX_DUMB_BUFFERS) && CreateDumbBuffer(platform.dumbBufferCount, width, height, bpp, depth)) platform.dumbBufferCount++;
 
-        if (encoder && encoder->crtc_id)
-        {
-            crtcId = encoder->crtc_id;
-            platform.crtc = drmModeGetCrtc(platform.fd, crtcId);
+            if (platform.dumbBufferCount < MAX_DUMB_BUFFERS)
+            {
+                TRACELOG(LOG_WARNING, "DISPLAY: Failed to create dumb buffers for direct rendering, frames are copied");
+                for (int i = 1; i < platform.dumbBufferCount; i++) DestroyDumbBuffer(i);
+                platform.dumbBufferCount = 1;
+            }
         }
+    #endif
+
+        // Find a CRTC compatible with the connector
+        uint32_t crtcId = 0;
+        if (platform.crtc) crtcId = platform.crtc->crtc_id;
         else
         {
-            // Find a free CRTC
-            for (int i = 0; i < res->count_crtcs; i++)
+            // Find a CRTC that's compatible with this connector
+            drmModeRes *res = drmModeGetResources(platform.fd);
+            if (res)
             {
-                drmModeCrtc *crtc = drmModeGetCrtc(platform.fd, res->crtcs[i]);
-                if (crtc && !crtc->buffer_id) // CRTC is free
+                // Check which CRTCs are compatible with this connector
+                drmModeEncoder *encoder = NULL;
+                if (platform.connector->encoder_id) encoder = drmModeGetEncoder(platform.fd, platform.connector->encoder_id);
+
+                if (encoder && encoder->crtc_id)
+                {
+                    crtcId = encoder->crtc_id;
+                    platform.crtc = drmModeGetCrtc(platform.fd, crtcId);
+                }
+                else
                 {
-                    crtcId = res->crtcs[i];
-                    if (platform.crtc) drmModeFreeCrtc(platform.crtc);
-                    platform.crtc = crtc;
-                    break;
+                    // Find a free CRTC
+                    for (int i = 0; i < res->count_crtcs; i++)
+                    {
+                        drmModeCrtc *crtc = drmModeGetCrtc(platform.fd, res->crtcs[i]);
+                        if (crtc && !crtc->buffer_id) // CRTC is free
+                        {
+                            crtcId = res->crtcs[i];
+                            if (platform.crtc) drmModeFreeCrtc(platform.crtc);
+                            platform.crtc = crtc;
+                            break;
+                        }
+
+                        if (crtc) drmModeFreeCrtc(crtc);
+                    }
                 }
 
-                if (crtc) drmModeFreeCrtc(crtc);
+                if (encoder) drmModeFreeEncoder(encoder);
+                drmModeFreeResources(res);
+
+                if (!crtcId) TRACELOG(LOG_ERROR, "DISPLAY: No compatible CRTC found");
             }
+            else TRACELOG(LOG_ERROR, "DISPLAY: Failed to get DRM resources");
         }
 
-        if (encoder) drmModeFreeEncoder(encoder);
-        drmModeFreeResources(res);
+        // Set CRTC with better error handling
+        int result = crtcId? drmModeSetCrtc(platform.fd, crtcId, platform.dumbFB[0], 0, 0, &platform.connector->connector_id, 1, mode) : -1;
+        if (crtcId && (result != 0))
+        {
+            TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d (%s)", result, strerror(errno));
+            TRACELOG(LOG_ERROR, "DISPLAY: CRTC ID: %u, FB ID: %u, Connector ID: %u", crtcId, platform.dumbFB[0], platform.connector->connector_id);
+            TRACELOG(LOG_ERROR, "DISPLAY: Mode: %dx%d@%d", mode->hdisplay, mode->vdisplay, mode->vrefresh);
+        }
 
-        if (!crtcId)
+        if (result != 0)
         {
-            TRACELOG(LOG_ERROR, "DISPLAY: No compatible CRTC found");
-            drmModeRmFB(platform.fd, fb);
-            struct drm_mode_destroy_dumb dreq = {0};
-            dreq.handle = creq.handle;
-            drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+            for (int i = 0; i < platform.dumbBufferCount; i++) DestroyDumbBuffer(i);
+            platform.dumbBufferCount = 0;
             return;
         }
+
+        // The first dumb buffer is scanned out, the next one is rendered into
+        platform.dumbBack = 1;
+        fullUpdate = true;
     }
 
-    // Set CRTC with better error handling
-    result = drmModeSetCrtc(platform.fd, crtcId, fb, 0, 0, &platform.connector->connector_id, 1, mode);
-    if (result != 0) 
+    if (platform.dumbBufferCount > 1)
     {
-        TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d (%s)", result, strerror(errno));
-        TRACELOG(LOG_ERROR, "DISPLAY: CRTC ID: %u, FB ID: %u, Connector ID: %u", crtcId, fb, platform.connector->connector_id);
-        TRACELOG(LOG_ERROR, "DISPLAY: Mode: %dx%d@%d", mode->hdisplay, mode->vdisplay, mode->vrefresh);
-        
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = {0};
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        // The back dumb buffer is neither scanned out nor waiting for a flip once the previous flip completed
+        WaitDumbBufferFlip();
+
+        // Frame rendered into the rlsw owned color buffer (first frame or framebuffer resized), copied with scaling if needed
+        if (colorBuffer != platform.dumbBuffer[platform.dumbBack])
+        {
+            if ((bufferWidth == width) && (bufferHeight == height)) swCopyFramebuffer(0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, platform.dumbBuffer[platform.dumbBack]);
+            else swBlitFramebuffer(0, 0, width, height, 0, 0, bufferWidth, bufferHeight, SW_RGBA, SW_UNSIGNED_BYTE, platform.dumbBuffer[platform.dumbBack]);
+        }
+
+        // Scan out the rendered dumb buffer on next vblank, the flip completion is only waited for next frame
+        if (drmModePageFlip(platform.fd, platform.crtc->crtc_id, platform.dumbFB[platform.dumbBack], DRM_MODE_PAGE_FLIP_EVENT, NULL) == 0) platform.dumbFlipPending = true;
+        else drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, platform.dumbFB[platform.dumbBack], 0, 0, &platform.connector->connector_id, 1, mode);
+
+        // Next frame is rendered into the dumb buffer scanned out before the previous flip
+        platform.dumbBack = (platform.dumbBack + 1)%platform.dumbBufferCount;
+        if ((bufferWidth == width) && (bufferHeight == height)) swSetColorBuffer(platform.dumbBuffer[platform.dumbBack]);
+
+        swResetDirtyRect();
         return;
     }
 
-    // Clean up previous framebuffer
-    if (platform.prevFB)
+    // Copy the software rendered buffer to the dumb buffer with scaling if needed
+    if (bufferWidth == width && bufferHeight == height)
     {
-        result = drmModeRmFB(platform.fd, platform.prevFB);
-        if (result != 0) TRACELOG(LOG_WARNING, "DISPLAY: drmModeRmFB() failed with result: %d", result);
-    }
+        // Direct copy if sizes match, only the region modified since last swap
+        int x = 0, y = 0, w = bufferWidth, h = bufferHeight;
+        if (!swGetDirtyRect(&x, &y, &w, &h) && !fullUpdate) return;
+        if (fullUpdate) { x = 0; y = 0; w = bufferWidth; h = bufferHeight; }
 
-    platform.prevFB = fb;
+        // The previous frame may still be written to the dumb buffer, its clip region is in use until then
+        swWaitPresent();
+        platform.dumbClip = (drmModeClip){ (unsigned short)x, (unsigned short)y, (unsigned short)(x + w), (unsigned short)(y + h) };
 
-    // Clean up previous dumb buffer
-    if (platform.prevDumbHandle)
+        // NOTE: With SW_ENABLE_ASYNC_PRESENT, the copy is done while the next frame is rendered
+        swPixelStorei(SW_PACK_ROW_LENGTH, platform.dumbBufferPitch/4);
+        swPresentFramebuffer(x, y, w, h, SW_RGBA, SW_UNSIGNED_BYTE, (unsigned char *)platform.dumbBuffer[0] + y*platform.dumbBufferPitch + x*4,
+            DumbBufferPresentHandler, &platform.dumbClip);
+        swPixelStorei(SW_PACK_ROW_LENGTH, 0);
+    }
+    else
     {
-        struct drm_mode_destroy_dumb dreq = {0};
-        dreq.handle = platform.prevDumbHandle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        // Scale the software buffer to match the display mode
+        swWaitPresent();
+        platform.dumbClip = (drmModeClip){ 0, 0, (unsigned short)width, (unsigned short)height };
+
+        swBlitFramebuffer(0, 0, width, height, 0, 0, bufferWidth, bufferHeight, SW_RGBA, SW_UNSIGNED_BYTE, platform.dumbBuffer[0]);
+        DumbBufferPresentHandler(&platform.dumbClip);
     }
 
-    platform.prevDumbHandle = creq.handle;
+    swResetDirtyRect();
 #endif
 }
 #endif // SUPPORT_DRM_CACHE
@@ -1158,7 +1162,17 @@ int InitPlatform(void)
     platform.gbmSurface = NULL;
     platform.prevBO = NULL;
 #else
-    platform.prevDumbHandle = 0;
+    for (int i = 0; i < MAX_DUMB_BUFFERS; i++)
+    {
+        platform.dumbHandle[i] = 0;
+        platform.dumbFB[i] = 0;
+        platform.dumbBuffer[i] = NULL;
+    }
+
+    platform.dumbBufferCount = 0;
+    platform.dumbBufferSize = 0;
+    platform.dumbBufferPitch = 0;
+    platform.dumbFlipPending = false;
 #endif
 
     // Initialize graphic device: display/window and graphic context
@@ -1630,6 +1644,12 @@ int InitPlatform(void)
 // Close platform
 void ClosePlatform(void)
 {
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    WaitDumbBufferFlip();
+    for (int i = 0; i < platform.dumbBufferCount; i++) DestroyDumbBuffer(i);
+    platform.dumbBufferCount = 0;
+#endif
+
     if (platform.prevFB)
     {
         drmModeRmFB(platform.fd, platform.prevFB);
@@ -2493,4 +2513,124 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
     return nearestIndex;
 }
 
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Create a dumb buffer, its DRM framebuffer and map it into userspace
+static bool CreateDumbBuffer(int index, uint width, uint height, uint bpp, uint depth)
+{
+    // Create a dumb buffer for software rendering
+    struct drm_mode_create_dumb creq = { 0 };
+    creq.width = width;
+    creq.height = height;
+    creq.bpp = bpp;
+
+    int result = drmIoctl(platform.fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq);
+    if (result < 0)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed to create dumb buffer: %s", strerror(errno));
+        return false;
+    }
+
+    platform.dumbHandle[index] = creq.handle;
+
+    // Create framebuffer with the correct format
+    result = drmModeAddFB(platform.fd, width, height, depth, bpp, creq.pitch, creq.handle, &platform.dumbFB[index]);
+    if (result != 0)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d (%s)", result, strerror(errno));
+        platform.dumbFB[index] = 0;
+        DestroyDumbBuffer(index);
+        return false;
+    }
+
+    // Map the dumb buffer to copy our software rendered buffer
+    struct drm_mode_map_dumb mreq = { 0 };
+    mreq.handle = creq.handle;
+    result = drmIoctl(platform.fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
+    if (result != 0)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed to map dumb buffer: %s", strerror(errno));
+        DestroyDumbBuffer(index);
+        return false;
+    }
+
+    // Map the buffer into userspace
+    // NOTE: Dumb buffers are kept mapped, they are either updated in place or rendered into directly
+    void *dumbBuffer = mmap(0, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, platform.fd, mreq.offset);
+    if (dumbBuffer == MAP_FAILED)
+    {
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed to mmap dumb buffer: %s", strerror(errno));
+        DestroyDumbBuffer(index);
+        return false;
+    }
+
+    platform.dumbBuffer[index] = dumbBuffer;
+    platform.dumbBufferSize = creq.size;
+    platform.dumbBufferPitch = creq.pitch;
+
+    return true;
+}
+
+// Unmap and destroy a dumb buffer and its DRM framebuffer
+static void DestroyDumbBuffer(int index)
+{
+    if (platform.dumbBuffer[index])
+    {
+        munmap(platform.dumbBuffer[index], platform.dumbBufferSize);
+        platform.dumbBuffer[index] = NULL;
+    }
+
+    if (platform.dumbFB[index])
+    {
+        drmModeRmFB(platform.fd, platform.dumbFB[index]);
+        platform.dumbFB[index] = 0;
+    }
+
+    if (platform.dumbHandle[index])
+    {
+        struct drm_mode_destroy_dumb dreq = { 0 };
+        dreq.handle = platform.dumbHandle[index];
+        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        platform.dumbHandle[index] = 0;
+    }
+}
+
+// Dumb buffer present handler
+// NOTE: Called once the frame has been written to the dumb buffer, from the rlsw present thread with SW_ENABLE_ASYNC_PRESENT
+static void DumbBufferPresentHandler(void *data)
+{
+    // Notify the modified region, required by drivers that do not scan out the dumb buffer memory directly
+    // NOTE: Not all drivers implement it (ENOSYS), in that case the buffer is already presented as is
+    drmModeDirtyFB(platform.fd, platform.dumbFB[0], (drmModeClip *)data, 1);
+}
+
+// Dumb buffer page flip handler
+// NOTE: Called once the drmModePageFlip() finished from the drmHandleEvent() context
+static void DumbBufferFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+{
+    // Unused inputs
+    (void)fd;
+    (void)frame;
+    (void)sec;
+    (void)usec;
+    (void)data;
+
+    platform.dumbFlipPending = false;
+}
+
+// Wait for the pending dumb buffer page flip, the previously scanned out buffer can be rendered into after it
+static void WaitDumbBufferFlip(void)
+{
+    drmEventContext evctx = {
+        .version = DRM_EVENT_CONTEXT_VERSION,
+        .page_flip_handler = DumbBufferFlipHandler
+    };
+
+    // NOTE: drmHandleEvent() blocks until events are read
+    while (platform.dumbFlipPending)
+    {
+        if (drmHandleEvent(platform.fd, &evctx) != 0) platform.dumbFlipPending = false;
+    }
+}
+#endif
+
 // EOF
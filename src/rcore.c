@@ -26,6 +26,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS (software rendering, no window):
+*           - Any system, offscreen rendering for batch jobs and CI
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -563,6 +565,8 @@ const char *TextFormat(const char *text, ...); // Formatting of text with variab
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -637,6 +641,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS (software)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -705,6 +711,11 @@ void InitWindow(int width, int height, const char *title)
     // Setup default viewport
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // Software renderer has no multisampled framebuffer, edges are anti-aliased analytically instead
+    if (CORE.Window.flags & FLAG_MSAA_4X_HINT) rlEnableAntialiasing();
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT)
     #if defined(SUPPORT_DEFAULT_FONT)
         // Load default font
@@ -916,6 +927,7 @@ void BeginDrawing(void)
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    rlDrawSubmittedCommandLists();  // Draw command lists submitted for this frame (recorded on worker threads)
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
 #if defined(SUPPORT_GIF_RECORDING)
@@ -1186,7 +1198,8 @@ void EndBlendMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void BeginScissorMode(int x, int y, int width, int height)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    // NOTE: With batch sorting draw calls keep their scissor, no need to draw the batch
+    if (!rlIsBatchSortingEnabled()) rlDrawRenderBatchActive(); // Update and draw internal render batch
 
     rlEnableScissorTest();
 
@@ -1212,7 +1225,7 @@ void BeginScissorMode(int x, int y, int width, int height)
 // End scissor mode
 void EndScissorMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    if (!rlIsBatchSortingEnabled()) rlDrawRenderBatchActive(); // Update and draw internal render batch
     rlDisableScissorTest();
 }
 
@@ -1750,6 +1763,12 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
+#if defined(PLATFORM_HEADLESS)
+    // Headless platform time is simulated, waiting just advances it
+    platform.time += seconds;
+    return;
+#endif
+
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
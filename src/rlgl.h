@@ -46,16 +46,25 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_BATCH_INTERLEAVED
+*           Store render batch vertex data interleaved (position, texcoord, color, normal) in a single
+*           vertex buffer, every vertex is written contiguously and the batch is uploaded at once
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
-*       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_BUFFERS              3    // Default number of batch buffers (multi-buffering, drawn in a ring)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
+*       #define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS 65536 // Maximum elements the default render batch buffers can grow to
+*       #define RL_DEFAULT_BATCH_MAX_DRAWCALLS     4096    // Maximum draw calls the default render batch can grow to
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_VERTEX_NORMALS       1    // Store normals on interleaved batch vertex data, required by lighting shaders
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS     16    // Maximum number of texture slots tracked by render state cache
+*       #define RL_MAX_SUBMITTED_COMMAND_LISTS       64    // Maximum number of command lists submitted per frame
 *       #define RL_CULL_DISTANCE_NEAR              0.05    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             4000.0    // Default projection matrix far cull distance
 *
@@ -219,14 +228,23 @@
     #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
-    #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
+    #define RL_DEFAULT_BATCH_BUFFERS                 3      // Default number of batch buffers (multi-buffering, drawn in a ring)
 #endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
+#ifndef RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS
+    #define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS 65536      // Maximum elements the default render batch buffers can grow to
+#endif
+#ifndef RL_DEFAULT_BATCH_MAX_DRAWCALLS
+    #define RL_DEFAULT_BATCH_MAX_DRAWCALLS        4096      // Maximum draw calls the default render batch can grow to
+#endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_VERTEX_NORMALS
+    #define RL_DEFAULT_BATCH_VERTEX_NORMALS          1      // Store normals on interleaved batch vertex data (RLGL_ENABLE_BATCH_INTERLEAVED)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -238,6 +256,16 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// Render state cache limits
+#ifndef RL_MAX_STATE_CACHE_TEXTURE_SLOTS
+    #define RL_MAX_STATE_CACHE_TEXTURE_SLOTS        16      // Maximum number of texture slots tracked by render state cache
+#endif
+
+// Command lists limits
+#ifndef RL_MAX_SUBMITTED_COMMAND_LISTS
+    #define RL_MAX_SUBMITTED_COMMAND_LISTS          64      // Maximum number of command lists submitted per frame
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.05      // Default near cull distance
@@ -387,13 +415,29 @@ typedef struct Matrix {
 #endif
 
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+// Interleaved batch vertex, all the attributes of a vertex stored contiguously
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+#if RL_DEFAULT_BATCH_VERTEX_NORMALS
+    float normal[3];            // Vertex normal (XYZ) (shader-location = 2)
+#endif
+} rlBatchVertex;
+#endif
+
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    rlBatchVertex *data;        // Vertex data, interleaved attributes (4 vertex per quad)
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -401,21 +445,28 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data, interleaved data uses vboId[0])
 } rlVertexBuffer;
 
 // Draw call type
-// NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
-// of those state-change happens (this is done in core module)
+// NOTE: Only texture changes register a new draw by default, other state changes (shader, blend mode,
+// scissor, matrices) force a batch draw call, raylib does it on core module when required
+// With batch sorting enabled, shader, blend mode and scissor changes also register a new draw,
+// draws keep their own state and compatible ones are merged when the batch is drawn
 typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
 
+    unsigned int shaderId;      // Shader id to be used on the draw (batch sorting)
+    int *shaderLocs;            // Shader locations to be used on the draw (batch sorting)
+    int blendMode;              // Blend mode to be used on the draw (batch sorting)
+    bool scissorTest;           // Scissor test enabled for the draw (batch sorting)
+    int scissor[4];             // Scissor rectangle for the draw: x, y, width, height (batch sorting)
+    float bounds[6];            // Vertex position bounds of the draw: min XYZ, max XYZ (batch sorting)
+
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
 } rlDrawCall;
@@ -428,9 +479,59 @@ typedef struct rlRenderBatch {
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
+    int drawCapacity;           // Draw calls array size (default batch grows it when required)
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Command list vertex, recorded vertex data
+typedef struct rlCommandVertex {
+    float position[3];          // Vertex position (XYZ)
+    float texcoord[2];          // Vertex texture coordinates (UV)
+    float normal[3];            // Vertex normal (XYZ)
+    unsigned char color[4];     // Vertex color (RGBA)
+    bool depth2D;               // Vertex defined in 2D, depth set on drawing (rlVertex2f())
+} rlCommandVertex;
+
+// Command list command, recorded drawing or state change
+typedef struct rlCommand {
+    int type;                   // Command type (rlCommandType)
+    int mode;                   // Drawing mode (RL_COMMAND_BEGIN) or blend mode (RL_COMMAND_SET_BLEND_MODE)
+    unsigned int id;            // Texture id (RL_COMMAND_SET_TEXTURE) or shader id (RL_COMMAND_SET_SHADER)
+    int *locs;                  // Shader locations (RL_COMMAND_SET_SHADER)
+    int vertexOffset;           // First vertex of the drawing (RL_COMMAND_BEGIN)
+    int vertexCount;            // Number of vertex of the drawing (RL_COMMAND_BEGIN)
+} rlCommand;
+
+// Command list type, vertex data and state changes recorded to be drawn later
+// NOTE: Recording only accesses the list, so lists can be recorded on worker threads (one thread per list)
+typedef struct rlCommandList {
+    rlCommandVertex *vertices;  // Recorded vertex data
+    int vertexCount;            // Recorded vertex counter
+    int vertexCapacity;         // Vertex data capacity (grows on recording)
+    rlCommand *commands;        // Recorded commands
+    int commandCount;           // Recorded commands counter
+    int commandCapacity;        // Commands capacity (grows on recording)
+
+    float texcoord[2];          // Current texture coordinates, added on vertex recording
+    float normal[3];            // Current normal, added on vertex recording
+    unsigned char color[4];     // Current color, added on vertex recording
+} rlCommandList;
+
+// Software renderer statistics, accumulated until reset
+// NOTE: Only gathered when rlsw is compiled with SW_ENABLE_STATS, zeroed otherwise
+typedef struct rlSoftwareStats {
+    unsigned int primitivesSubmitted;       // Primitives sent to the rasterizer
+    unsigned int primitivesClipped;         // Primitives discarded by clipping
+    unsigned int primitivesCulled;          // Primitives discarded by face culling
+    unsigned int fragmentsShaded;           // Fragments written to the color buffer
+    unsigned int fragmentsDepthRejected;    // Fragments discarded by depth test
+    unsigned int fragmentsBlended;          // Fragments blended with the color buffer
+    unsigned int texelsFetched;             // Texels read by texture sampling
+    double clearTime;                       // Time clearing buffers (seconds)
+    double rasterTime;                      // Time rasterizing primitives (seconds)
+    double copyTime;                        // Time copying the color buffer (seconds)
+} rlSoftwareStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11_SOFTWARE = 0,  // Software rendering
@@ -599,6 +700,14 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Command list command type
+typedef enum {
+    RL_COMMAND_BEGIN = 0,       // Drawing of a range of vertex (rlBegin()/rlEnd())
+    RL_COMMAND_SET_TEXTURE,     // Texture change (rlSetTexture())
+    RL_COMMAND_SET_SHADER,      // Shader change (rlSetShader())
+    RL_COMMAND_SET_BLEND_MODE   // Blend mode change (rlSetBlendMode())
+} rlCommandType;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -709,6 +818,8 @@ RLAPI void rlCheckErrors(void);                         // Check and log OpenGL
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
+RLAPI void rlResetStateCache(void);                     // Reset render state cache, required if OpenGL state is changed outside rlgl
+RLAPI unsigned int rlGetStateCacheSkippedCalls(void);   // Get number of redundant state calls skipped by render state cache
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -737,9 +848,32 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI void rlEnableBatchSorting(void);                  // Enable batch sorting, draws keep their state and get merged by state on batch drawing
+RLAPI void rlDisableBatchSorting(void);                 // Disable batch sorting
+RLAPI bool rlIsBatchSortingEnabled(void);               // Check if batch sorting is enabled
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Command lists management
+// NOTE: Command lists can be recorded on worker threads (one thread per list),
+// they are drawn on the main thread, submitted lists are drawn in order at frame end
+RLAPI rlCommandList rlLoadCommandList(int vertexCapacity); // Load a command list, grows on recording
+RLAPI void rlUnloadCommandList(rlCommandList list);     // Unload command list
+RLAPI void rlResetCommandList(rlCommandList *list);     // Reset command list recorded data, keeping its memory
+RLAPI void rlCommandListBegin(rlCommandList *list, int mode); // Record drawing mode begin (how to organize vertex)
+RLAPI void rlCommandListEnd(rlCommandList *list);       // Record drawing mode end
+RLAPI void rlCommandListVertex2f(rlCommandList *list, float x, float y); // Record one vertex (position) - 2 float
+RLAPI void rlCommandListVertex3f(rlCommandList *list, float x, float y, float z); // Record one vertex (position) - 3 float
+RLAPI void rlCommandListTexCoord2f(rlCommandList *list, float x, float y); // Record vertex texture coordinate - 2 float
+RLAPI void rlCommandListNormal3f(rlCommandList *list, float x, float y, float z); // Record vertex normal - 3 float
+RLAPI void rlCommandListColor4ub(rlCommandList *list, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Record vertex color - 4 byte
+RLAPI void rlCommandListSetTexture(rlCommandList *list, unsigned int id); // Record texture change
+RLAPI void rlCommandListSetShader(rlCommandList *list, unsigned int id, int *locs); // Record shader change
+RLAPI void rlCommandListSetBlendMode(rlCommandList *list, int mode); // Record blend mode change
+RLAPI void rlDrawCommandList(const rlCommandList *list); // Draw command list, recorded data is added to current render batch
+RLAPI void rlSubmitCommandList(const rlCommandList *list); // Submit command list to be drawn at frame end (in submission order)
+RLAPI void rlDrawSubmittedCommandLists(void);           // Draw submitted command lists in submission order and clear submissions
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -777,7 +911,16 @@ RLAPI bool rlFramebufferComplete(unsigned int id);                        // Ver
 RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Delete framebuffer from GPU
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
 RLAPI void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels); // Copy framebuffer pixel data to internal buffer
+RLAPI void rlCopyFramebufferRegion(int x, int y, int width, int height, int format, int rowLength, void *pixels); // Copy framebuffer region pixel data to a buffer with rowLength pixels per row
 RLAPI void rlResizeFramebuffer(int width, int height);                    // Resize internal framebuffer
+RLAPI bool rlGetFramebufferDirtyRect(int *x, int *y, int *width, int *height); // Get framebuffer region modified since last reset, false if unmodified
+RLAPI void rlResetFramebufferDirtyRect(void);                             // Reset framebuffer modified region tracking
+RLAPI void rlEnablePartialClear(void);                                    // Enable partial clear, only the region drawn since last clear gets cleared
+RLAPI void rlDisablePartialClear(void);                                   // Disable partial clear
+RLAPI void rlEnableAntialiasing(void);                                    // Enable anti-aliasing, polygon edges and thin lines coverage
+RLAPI void rlDisableAntialiasing(void);                                   // Disable anti-aliasing
+RLAPI rlSoftwareStats rlGetSoftwareStats(void);                           // Get software renderer statistics since last reset
+RLAPI void rlResetSoftwareStats(void);                                    // Reset software renderer statistics
 #endif
 
 // Shaders management
@@ -912,6 +1055,7 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <stdlib.h>                     // Required for: calloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stddef.h>                     // Required for: offsetof() [Used in rlSetBatchVertexAttribs()]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -1058,9 +1202,33 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// Default render batch growth limit
+// NOTE: OpenGL ES 2.0 batch uses 16bit indices, limited to 65536 vertex (16384 quads)
+#if defined(GRAPHICS_API_OPENGL_ES2) && (RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS > 16384)
+    #define RL_BATCH_MAX_BUFFER_ELEMENTS        16384
+#else
+    #define RL_BATCH_MAX_BUFFER_ELEMENTS        RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
+// Render state cache, shadows the state set on OpenGL (or rlsw) to skip redundant calls
+// NOTE: Values are -1 while unknown, so first call always reaches OpenGL
+typedef struct rlglStateCache {
+    int activeTextureSlot;                  // Active texture slot
+    int textureId[RL_MAX_STATE_CACHE_TEXTURE_SLOTS]; // Texture id bound to GL_TEXTURE_2D, per texture slot
+    int texture2D;                          // Texture 2D enabled (only OpenGL 1.1)
+    int shaderId;                           // Shader program id in use
+    int blendMode;                          // Blending mode factors and equation set
+    int colorBlend;                         // Color blending enabled
+    int depthTest;                          // Depth test enabled
+    int depthMask;                          // Depth write enabled
+    int backfaceCulling;                    // Backface culling enabled
+
+    unsigned int skippedCalls;              // Redundant state calls skipped (debug counter)
+} rlglStateCache;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1113,6 +1281,17 @@ typedef struct rlglData {
         int glBlendEquationAlpha;           // Blending equation for alpha
         bool glCustomBlendModeModified;     // Custom blending factor and equation modification status
 
+        bool scissorTest;                   // Scissor test enabled
+        int scissor[4];                     // Scissor rectangle: x, y, width, height
+
+        bool batchSorting;                  // Batch sorting enabled, draw calls keep their state (shader, blend mode, scissor)
+        unsigned char *sortBuffer;          // Batch sorting vertex data copy, used to reorder draw calls vertex data
+        int sortBufferSize;                 // Batch sorting vertex data copy size in bytes
+        int *sortDraws;                     // Batch sorting data by draw call (offsets, groups)
+        int sortDrawsCapacity;              // Batch sorting data by draw call capacity
+
+        int batchHighWater;                 // Default batch elements high-water mark of recent batch draws (slowly decaying)
+
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
@@ -1139,6 +1318,14 @@ typedef struct rlglData {
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+
+    rlglStateCache Cache;                   // Render state cache
+} rlglData;
+
+#else
+
+typedef struct rlglData {
+    rlglStateCache Cache;                   // Render state cache
 } rlglData;
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1149,9 +1336,10 @@ typedef struct rlglData {
 static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
 static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static const rlCommandList *rlSubmittedCommandLists[RL_MAX_SUBMITTED_COMMAND_LISTS] = { 0 }; // Command lists submitted to be drawn at frame end
+static int rlSubmittedCommandListsCount = 0;    // Command lists submitted counter
+
 static rlglData RLGL = { 0 };
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
@@ -1171,11 +1359,24 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+static void rlSetBatchVertexAttribs(const rlVertexBuffer *buffer); // Bind interleaved batch vertex buffer and setup attributes for current shader
+#endif
+static void rlSetBlendModeState(int mode);  // Set blend factors and equation for a blend mode
+static void rlSetBatchShader(unsigned int id, int *locs); // Set shader for batch drawing, uploading current matrices
+static void rlBatchStateChanged(void);      // Register a state change on current batch, starting a new draw call (batch sorting)
+static void rlSortRenderBatch(rlRenderBatch *batch); // Reorder batch draw calls by state, merging compatible ones (batch sorting)
+static void rlResizeRenderBatchBuffer(rlVertexBuffer *buffer, int elementCount); // Resize render batch vertex buffer (RAM and VRAM), keeping its vertex data
+static bool rlGrowRenderBatch(rlRenderBatch *batch, int vCount); // Grow default render batch current buffer to fit vertex, returns true if they fit
+static bool rlGrowRenderBatchDraws(rlRenderBatch *batch); // Grow default render batch draw calls array, returns true if grown
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static bool rlUpdateStateCache(int *state, int value);  // Update render state cache value, returns true if changed
+static rlCommand *rlCommandListPush(rlCommandList *list, int type); // Add a new command to command list, growing it if required
+static void rlBindTexture2D(unsigned int id);       // Bind texture to active slot, skipped if already bound
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -1502,7 +1703,7 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if ((RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity) && !rlGrowRenderBatchDraws(RLGL.currentBatch)) rlDrawRenderBatch(RLGL.currentBatch);
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.currentTextureId;
@@ -1516,7 +1717,9 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+    // NOTE: Depth is limited to stay inside default 2D projection (z-near 0.0, z-far 1.0), grown batches
+    // could reach the limit, following shapes share depth and are still drawn in order (GL_LEQUAL)
+    if (RLGL.currentBatch->currentDepth < -(1.0f/20000.0f)) RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 }
 
 // Define one vertex (position)
@@ -1560,6 +1763,53 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    // Batch sorting: draw state is captured with its first vertex,
+    // vertex bounds are used to find the overlapping draws that can not be reordered
+    if (RLGL.State.batchSorting)
+    {
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (draw->vertexCount == 0)
+        {
+            draw->shaderId = RLGL.State.currentShaderId;
+            draw->shaderLocs = RLGL.State.currentShaderLocs;
+            draw->blendMode = RLGL.State.currentBlendMode;
+            draw->scissorTest = RLGL.State.scissorTest;
+            for (int i = 0; i < 4; i++) draw->scissor[i] = RLGL.State.scissor[i];
+
+            draw->bounds[0] = draw->bounds[3] = tx;
+            draw->bounds[1] = draw->bounds[4] = ty;
+            draw->bounds[2] = draw->bounds[5] = tz;
+        }
+        else
+        {
+            if (tx < draw->bounds[0]) draw->bounds[0] = tx; else if (tx > draw->bounds[3]) draw->bounds[3] = tx;
+            if (ty < draw->bounds[1]) draw->bounds[1] = ty; else if (ty > draw->bounds[4]) draw->bounds[4] = ty;
+            if (tz < draw->bounds[2]) draw->bounds[2] = tz; else if (tz > draw->bounds[5]) draw->bounds[5] = tz;
+        }
+    }
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    // Add vertex, all attributes written contiguously
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].data[RLGL.State.vertexCounter];
+
+    vertex->position[0] = tx;
+    vertex->position[1] = ty;
+    vertex->position[2] = tz;
+
+    vertex->texcoord[0] = RLGL.State.texcoordx;
+    vertex->texcoord[1] = RLGL.State.texcoordy;
+
+    vertex->color[0] = RLGL.State.colorr;
+    vertex->color[1] = RLGL.State.colorg;
+    vertex->color[2] = RLGL.State.colorb;
+    vertex->color[3] = RLGL.State.colora;
+#if RL_DEFAULT_BATCH_VERTEX_NORMALS
+    vertex->normal[0] = RLGL.State.normalx;
+    vertex->normal[1] = RLGL.State.normaly;
+    vertex->normal[2] = RLGL.State.normalz;
+#endif
+#else
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1579,6 +1829,7 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+#endif
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1704,7 +1955,7 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if ((RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity) && !rlGrowRenderBatchDraws(RLGL.currentBatch)) rlDrawRenderBatch(RLGL.currentBatch);
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1717,7 +1968,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    if (rlUpdateStateCache(&RLGL.Cache.activeTextureSlot, slot)) glActiveTexture(GL_TEXTURE0 + slot);
 #endif
 }
 
@@ -1725,18 +1976,18 @@ void rlActiveTextureSlot(int slot)
 void rlEnableTexture(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
-    glEnable(GL_TEXTURE_2D);
+    if (rlUpdateStateCache(&RLGL.Cache.texture2D, 1)) glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 }
 
 // Disable texture
 void rlDisableTexture(void)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
-    glDisable(GL_TEXTURE_2D);
+    if (rlUpdateStateCache(&RLGL.Cache.texture2D, 0)) glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 }
 
 // Enable texture cubemap
@@ -1758,7 +2009,7 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1799,7 +2050,7 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1849,7 +2100,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    if (rlUpdateStateCache(&RLGL.Cache.shaderId, (int)id)) glUseProgram(id);
 #endif
 }
 
@@ -1857,14 +2108,14 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    if (rlUpdateStateCache(&RLGL.Cache.shaderId, 0)) glUseProgram(0);
 #endif
 }
 
 // Enable rendering to texture (fbo)
 void rlEnableFramebuffer(unsigned int id)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
 }
@@ -1873,7 +2124,7 @@ void rlEnableFramebuffer(unsigned int id)
 unsigned int rlGetActiveFramebuffer(void)
 {
     GLint fboId = 0;
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &fboId);
 #endif
     return fboId;
@@ -1882,7 +2133,7 @@ unsigned int rlGetActiveFramebuffer(void)
 // Disable rendering to texture
 void rlDisableFramebuffer(void)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
@@ -1898,7 +2149,7 @@ void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX
 // Bind framebuffer object (fbo)
 void rlBindFramebuffer(unsigned int target, unsigned int framebuffer)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(target, framebuffer);
 #endif
 }
@@ -1941,28 +2192,28 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { if (rlUpdateStateCache(&RLGL.Cache.colorBlend, 1)) glEnable(GL_BLEND); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { if (rlUpdateStateCache(&RLGL.Cache.colorBlend, 0)) glDisable(GL_BLEND); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { if (rlUpdateStateCache(&RLGL.Cache.depthTest, 1)) glEnable(GL_DEPTH_TEST); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { if (rlUpdateStateCache(&RLGL.Cache.depthTest, 0)) glDisable(GL_DEPTH_TEST); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { if (rlUpdateStateCache(&RLGL.Cache.depthMask, 1)) glDepthMask(GL_TRUE); }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { if (rlUpdateStateCache(&RLGL.Cache.depthMask, 0)) glDepthMask(GL_FALSE); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { if (rlUpdateStateCache(&RLGL.Cache.backfaceCulling, 1)) glEnable(GL_CULL_FACE); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { if (rlUpdateStateCache(&RLGL.Cache.backfaceCulling, 0)) glDisable(GL_CULL_FACE); }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1979,13 +2230,37 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting && !RLGL.State.scissorTest) rlBatchStateChanged();
+    RLGL.State.scissorTest = true;
+#endif
+    glEnable(GL_SCISSOR_TEST);
+}
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting && RLGL.State.scissorTest) rlBatchStateChanged();
+    RLGL.State.scissorTest = false;
+#endif
+    glDisable(GL_SCISSOR_TEST);
+}
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting && RLGL.State.scissorTest) rlBatchStateChanged();
+    RLGL.State.scissor[0] = x;
+    RLGL.State.scissor[1] = y;
+    RLGL.State.scissor[2] = width;
+    RLGL.State.scissor[3] = height;
+#endif
+    glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -2145,29 +2420,14 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: Custom blend factors are not kept by draw calls, changes from or to custom modes always draw the batch
+        bool customBlend = (mode == RL_BLEND_CUSTOM) || (mode == RL_BLEND_CUSTOM_SEPARATE) ||
+            (RLGL.State.currentBlendMode == RL_BLEND_CUSTOM) || (RLGL.State.currentBlendMode == RL_BLEND_CUSTOM_SEPARATE);
 
-        switch (mode)
-        {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
-            } break;
-            default: break;
-        }
+        if (RLGL.State.batchSorting && !customBlend) rlBatchStateChanged();
+        else rlDrawRenderBatch(RLGL.currentBatch);
+
+        rlSetBlendModeState(mode);
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
@@ -2215,6 +2475,31 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
 #endif
 }
 
+// Reset render state cache, next state calls always reach OpenGL
+// NOTE: Required if OpenGL state is changed outside rlgl (direct OpenGL calls or rlsw context switch)
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.activeTextureSlot = -1;
+#else
+    RLGL.Cache.activeTextureSlot = 0;   // Only texture slot 0 used
+#endif
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++) RLGL.Cache.textureId[i] = -1;
+    RLGL.Cache.texture2D = -1;
+    RLGL.Cache.shaderId = -1;
+    RLGL.Cache.blendMode = -1;
+    RLGL.Cache.colorBlend = -1;
+    RLGL.Cache.depthTest = -1;
+    RLGL.Cache.depthMask = -1;
+    RLGL.Cache.backfaceCulling = -1;
+}
+
+// Get number of redundant state calls skipped by render state cache
+unsigned int rlGetStateCacheSkippedCalls(void)
+{
+    return RLGL.Cache.skippedCalls;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -2282,6 +2567,8 @@ static void GLAPIENTRY rlDebugMessageCallback(GLenum source, GLenum type, GLuint
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+    rlResetStateCache();
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2333,17 +2620,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlDisableDepthTest();                                   // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlEnableColorBlend();                                   // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlEnableBackfaceCulling();                              // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2363,6 +2650,9 @@ void rlglInit(int width, int height)
         TRACELOG(RL_LOG_ERROR, "RLSW: Software renderer initialization failed!");
         exit(-1);
     }
+
+    // NOTE: Software renderer context created after initial states setup, state is unknown
+    rlResetStateCache();
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2388,13 +2678,22 @@ void rlglClose(void)
 
     rlUnloadShaderDefault(); // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlUnloadTexture(RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+    RL_FREE(RLGL.State.sortBuffer);     // Unload batch sorting buffer
+    RLGL.State.sortBuffer = NULL;
+    RLGL.State.sortBufferSize = 0;
+    RL_FREE(RLGL.State.sortDraws);      // Unload batch sorting draws data
+    RLGL.State.sortDraws = NULL;
+    RLGL.State.sortDrawsCapacity = 0;
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     swClose(); // Unload sofware renderer resources
 #endif
+
+    TRACELOG(RL_LOG_DEBUG, "RLGL: State cache skipped %u redundant state calls", RLGL.Cache.skippedCalls);
 }
 
 // Load OpenGL extensions
@@ -2809,10 +3108,14 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        batch.vertexBuffer[i].data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex)); // 4 vertex by quad
+#else
         batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));     // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));    // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));      // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_CALLOC(bufferElements*6, sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2820,10 +3123,12 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_CALLOC(bufferElements*6, sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
+#if !defined(RLGL_ENABLE_BATCH_INTERLEAVED)
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#endif
 
         int k = 0;
 
@@ -2857,6 +3162,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        // Quads - Interleaved vertex buffer binding and attributes enable
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].data, GL_DYNAMIC_DRAW);
+        rlSetBatchVertexAttribs(&batch.vertexBuffer[i]);
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
@@ -2885,6 +3197,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
@@ -2921,6 +3234,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
     batch.bufferCount = numBuffers;    // Record buffer count
     batch.drawCounter = 1;             // Reset draws counter
+    batch.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS; // Record draws array size
     batch.currentDepth = -1.0f;         // Reset depth value
     //--------------------------------------------------------------------------------------------
 #endif
@@ -2951,6 +3265,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         }
 
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Interleaved vertex data only generates vboId[0], deleting the unused 0 ids is silently ignored
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
@@ -2961,10 +3276,14 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        RL_FREE(batch.vertexBuffer[i].data);
+#else
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].normals);
         RL_FREE(batch.vertexBuffer[i].colors);
+#endif
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2985,9 +3304,18 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
+        // Batch sorting: reorder draws by state before upload, merging compatible ones
+        // NOTE: Not available with stereo rendering, eyes use different projections
+        if (RLGL.State.batchSorting && !RLGL.State.stereoRender && (batch->drawCounter > 1)) rlSortRenderBatch(batch);
+
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        // Interleaved vertex buffer, all attributes updated at once
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].data);
+#else
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
@@ -3007,6 +3335,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+#endif
 
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
@@ -3053,38 +3382,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
-
-            // Create modelview-projection matrix and upload to shader
-            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
-            }
-
-            // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
-            // transformations and rendering occur between rlPushMatrix() and rlPopMatrix()
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
-            }
+            rlSetBatchShader(RLGL.State.currentShaderId, RLGL.State.currentShaderLocs);
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+                // Bind vertex attribs: position, texcoord, normal and color from interleaved buffer
+                rlSetBatchVertexAttribs(&batch->vertexBuffer[batch->currentBuffer]);
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -3104,33 +3410,68 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
 
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
-
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
             for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlActiveTextureSlot(1 + i);
+                    rlBindTexture2D(RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlActiveTextureSlot(0);
+
+            // Batch sorting: state applied to the draws, GL shader, blend mode and scissor as currently set
+            unsigned int drawShaderId = RLGL.State.currentShaderId;
+            int drawBlendMode = RLGL.State.currentBlendMode;
+            bool drawScissorTest = RLGL.State.scissorTest;
+            int drawScissor[4] = { RLGL.State.scissor[0], RLGL.State.scissor[1], RLGL.State.scissor[2], RLGL.State.scissor[3] };
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Batch sorting: set the state kept by the draw call, if changed
+                if (RLGL.State.batchSorting && (batch->draws[i].vertexCount > 0))
+                {
+                    rlDrawCall *draw = &batch->draws[i];
+
+                    if (draw->shaderId != drawShaderId)
+                    {
+                        rlSetBatchShader(draw->shaderId, draw->shaderLocs);
+                        drawShaderId = draw->shaderId;
+                    }
+
+                    if (draw->blendMode != drawBlendMode)
+                    {
+                        rlSetBlendModeState(draw->blendMode);
+                        drawBlendMode = draw->blendMode;
+                    }
+
+                    if (draw->scissorTest != drawScissorTest)
+                    {
+                        if (draw->scissorTest) glEnable(GL_SCISSOR_TEST);
+                        else glDisable(GL_SCISSOR_TEST);
+                        drawScissorTest = draw->scissorTest;
+                    }
+
+                    if (draw->scissorTest && ((draw->scissor[0] != drawScissor[0]) || (draw->scissor[1] != drawScissor[1]) ||
+                        (draw->scissor[2] != drawScissor[2]) || (draw->scissor[3] != drawScissor[3])))
+                    {
+                        glScissor(draw->scissor[0], draw->scissor[1], draw->scissor[2], draw->scissor[3]);
+                        for (int k = 0; k < 4; k++) drawScissor[k] = draw->scissor[k];
+                    }
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlBindTexture2D(batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3149,18 +3490,31 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
+            // Batch sorting: restore current blend mode and scissor
+            if (drawBlendMode != RLGL.State.currentBlendMode) rlSetBlendModeState(RLGL.State.currentBlendMode);
+            if (drawScissorTest != RLGL.State.scissorTest)
+            {
+                if (RLGL.State.scissorTest) glEnable(GL_SCISSOR_TEST);
+                else glDisable(GL_SCISSOR_TEST);
+            }
+            if ((drawScissor[0] != RLGL.State.scissor[0]) || (drawScissor[1] != RLGL.State.scissor[1]) ||
+                (drawScissor[2] != RLGL.State.scissor[2]) || (drawScissor[3] != RLGL.State.scissor[3]))
+            {
+                glScissor(RLGL.State.scissor[0], RLGL.State.scissor[1], RLGL.State.scissor[2], RLGL.State.scissor[3]);
+            }
+
             if (!RLGL.ExtSupported.vao)
             {
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlBindTexture2D(0);    // Unbind textures
         }
 
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlDisableShader();  // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -3169,6 +3523,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
+    // Update default batch high-water mark, decaying slowly to follow recent batch draws
+    if (batch == &RLGL.defaultBatch)
+    {
+        int elementsUsed = (RLGL.State.vertexCounter + 3)/4;
+
+        RLGL.State.batchHighWater -= RLGL.State.batchHighWater/64;
+        if (elementsUsed > RLGL.State.batchHighWater) RLGL.State.batchHighWater = elementsUsed;
+    }
+
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
 
@@ -3180,7 +3543,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     RLGL.State.modelview = matModelView;
 
     // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < batch->drawCapacity; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
@@ -3197,6 +3560,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+    // Fit default batch next buffer to the high-water mark (with a margin), while it is empty,
+    // avoiding growing it while drawing, it only shrinks when 4x bigger than required
+    if (batch == &RLGL.defaultBatch)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        int elementCount = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+
+        while ((elementCount < (RLGL.State.batchHighWater + RLGL.State.batchHighWater/4)) && (elementCount < RL_BATCH_MAX_BUFFER_ELEMENTS)) elementCount *= 2;
+        if (elementCount > RL_BATCH_MAX_BUFFER_ELEMENTS) elementCount = RL_BATCH_MAX_BUFFER_ELEMENTS;
+
+        if ((elementCount > buffer->elementCount) || (buffer->elementCount >= elementCount*4)) rlResizeRenderBatchBuffer(buffer, elementCount);
+    }
 #endif
 }
 
@@ -3226,8 +3602,10 @@ bool rlCheckRenderBatchLimit(int vCount)
     bool overflow = false;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexCounter + vCount) >=
-        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    // NOTE: Default batch grows to fit the vertex when possible, avoiding drawing the batch
+    if (((RLGL.State.vertexCounter + vCount) >=
+        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)) &&
+        !rlGrowRenderBatch(RLGL.currentBatch, vCount))
     {
         overflow = true;
 
@@ -3246,6 +3624,252 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Enable batch sorting: shader, blend mode and scissor changes do not draw the batch,
+// draw calls keep their state and compatible draws are merged when the batch is drawn
+// NOTE: Draws are only reordered when they do not overlap on screen the draws they jump over, shader
+// uniforms set between draws apply to all the draws of the batch using that shader (last value set)
+void rlEnableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = true;
+#endif
+}
+
+// Disable batch sorting
+void rlDisableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = false;
+#endif
+}
+
+// Check if batch sorting is enabled
+bool rlIsBatchSortingEnabled(void)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = RLGL.State.batchSorting;
+#endif
+    return result;
+}
+
+// Load a command list, grows on recording
+rlCommandList rlLoadCommandList(int vertexCapacity)
+{
+    rlCommandList list = { 0 };
+
+    if (vertexCapacity < 4) vertexCapacity = 4;
+
+    list.vertices = (rlCommandVertex *)RL_MALLOC(vertexCapacity*sizeof(rlCommandVertex));
+    list.vertexCapacity = vertexCapacity;
+    list.commands = (rlCommand *)RL_MALLOC(32*sizeof(rlCommand));
+    list.commandCapacity = 32;
+
+    list.normal[2] = 1.0f;
+    list.color[0] = 255;
+    list.color[1] = 255;
+    list.color[2] = 255;
+    list.color[3] = 255;
+
+    return list;
+}
+
+// Unload command list
+void rlUnloadCommandList(rlCommandList list)
+{
+    RL_FREE(list.vertices);
+    RL_FREE(list.commands);
+}
+
+// Reset command list recorded data, keeping its memory
+void rlResetCommandList(rlCommandList *list)
+{
+    list->vertexCount = 0;
+    list->commandCount = 0;
+}
+
+// Record drawing mode begin (how to organize vertex)
+void rlCommandListBegin(rlCommandList *list, int mode)
+{
+    rlCommand *command = rlCommandListPush(list, RL_COMMAND_BEGIN);
+
+    command->mode = mode;
+    command->vertexOffset = list->vertexCount;
+}
+
+// Record drawing mode end
+void rlCommandListEnd(rlCommandList *list)
+{
+    if ((list->commandCount > 0) && (list->commands[list->commandCount - 1].type == RL_COMMAND_BEGIN))
+    {
+        rlCommand *command = &list->commands[list->commandCount - 1];
+        command->vertexCount = list->vertexCount - command->vertexOffset;
+    }
+}
+
+// Record one vertex (position) - 3 float
+void rlCommandListVertex3f(rlCommandList *list, float x, float y, float z)
+{
+    if (list->vertexCount >= list->vertexCapacity)
+    {
+        list->vertexCapacity *= 2;
+        list->vertices = (rlCommandVertex *)RL_REALLOC(list->vertices, list->vertexCapacity*sizeof(rlCommandVertex));
+    }
+
+    rlCommandVertex *vertex = &list->vertices[list->vertexCount];
+
+    vertex->position[0] = x;
+    vertex->position[1] = y;
+    vertex->position[2] = z;
+    vertex->texcoord[0] = list->texcoord[0];
+    vertex->texcoord[1] = list->texcoord[1];
+    vertex->normal[0] = list->normal[0];
+    vertex->normal[1] = list->normal[1];
+    vertex->normal[2] = list->normal[2];
+    vertex->color[0] = list->color[0];
+    vertex->color[1] = list->color[1];
+    vertex->color[2] = list->color[2];
+    vertex->color[3] = list->color[3];
+    vertex->depth2D = false;
+
+    list->vertexCount++;
+}
+
+// Record one vertex (position) - 2 float
+// NOTE: Vertex depth is set on drawing, as rlVertex2f() does
+void rlCommandListVertex2f(rlCommandList *list, float x, float y)
+{
+    rlCommandListVertex3f(list, x, y, 0.0f);
+    list->vertices[list->vertexCount - 1].depth2D = true;
+}
+
+// Record vertex texture coordinate - 2 float
+void rlCommandListTexCoord2f(rlCommandList *list, float x, float y)
+{
+    list->texcoord[0] = x;
+    list->texcoord[1] = y;
+}
+
+// Record vertex normal - 3 float
+void rlCommandListNormal3f(rlCommandList *list, float x, float y, float z)
+{
+    list->normal[0] = x;
+    list->normal[1] = y;
+    list->normal[2] = z;
+}
+
+// Record vertex color - 4 byte
+void rlCommandListColor4ub(rlCommandList *list, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    list->color[0] = r;
+    list->color[1] = g;
+    list->color[2] = b;
+    list->color[3] = a;
+}
+
+// Record texture change
+void rlCommandListSetTexture(rlCommandList *list, unsigned int id)
+{
+    rlCommandListPush(list, RL_COMMAND_SET_TEXTURE)->id = id;
+}
+
+// Record shader change
+void rlCommandListSetShader(rlCommandList *list, unsigned int id, int *locs)
+{
+    rlCommand *command = rlCommandListPush(list, RL_COMMAND_SET_SHADER);
+
+    command->id = id;
+    command->locs = locs;
+}
+
+// Record blend mode change
+void rlCommandListSetBlendMode(rlCommandList *list, int mode)
+{
+    rlCommandListPush(list, RL_COMMAND_SET_BLEND_MODE)->mode = mode;
+}
+
+// Draw command list, recorded data is added to current render batch
+// NOTE: Recorded state changes are kept after drawing, as immediate mode calls do
+// (submitted lists are drawn with state restored after them), current transform matrix is applied to recorded vertex
+void rlDrawCommandList(const rlCommandList *list)
+{
+    for (int i = 0; i < list->commandCount; i++)
+    {
+        const rlCommand *command = &list->commands[i];
+
+        switch (command->type)
+        {
+            case RL_COMMAND_BEGIN:
+            {
+                if (command->vertexCount <= 0) break;
+
+                // Avoid splitting small drawings between batches, big ones are split by rlVertex3f()
+                rlCheckRenderBatchLimit(command->vertexCount);
+
+                rlBegin(command->mode);
+                for (int v = command->vertexOffset; v < (command->vertexOffset + command->vertexCount); v++)
+                {
+                    const rlCommandVertex *vertex = &list->vertices[v];
+
+                    rlTexCoord2f(vertex->texcoord[0], vertex->texcoord[1]);
+                    rlNormal3f(vertex->normal[0], vertex->normal[1], vertex->normal[2]);
+                    rlColor4ub(vertex->color[0], vertex->color[1], vertex->color[2], vertex->color[3]);
+
+                    if (vertex->depth2D) rlVertex2f(vertex->position[0], vertex->position[1]);
+                    else rlVertex3f(vertex->position[0], vertex->position[1], vertex->position[2]);
+                }
+                rlEnd();
+            } break;
+            case RL_COMMAND_SET_TEXTURE: rlSetTexture(command->id); break;
+            case RL_COMMAND_SET_SHADER: rlSetShader(command->id, command->locs); break;
+            case RL_COMMAND_SET_BLEND_MODE: rlSetBlendMode(command->mode); break;
+            default: break;
+        }
+    }
+}
+
+// Submit command list to be drawn at frame end (in submission order)
+// NOTE: Submission must be done on the main thread, once list recording is finished,
+// the list must be kept alive (and not recorded) until it is drawn
+void rlSubmitCommandList(const rlCommandList *list)
+{
+    if (rlSubmittedCommandListsCount < RL_MAX_SUBMITTED_COMMAND_LISTS)
+    {
+        rlSubmittedCommandLists[rlSubmittedCommandListsCount] = list;
+        rlSubmittedCommandListsCount++;
+    }
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Maximum number of submitted command lists reached (%i)", RL_MAX_SUBMITTED_COMMAND_LISTS);
+}
+
+// Draw submitted command lists in submission order and clear submissions
+// NOTE: Texture, shader and blend mode are restored after drawing, so state changes
+// recorded by the lists do not leak into the drawing that follows on the main thread
+void rlDrawSubmittedCommandLists(void)
+{
+    if (rlSubmittedCommandListsCount == 0) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int textureId = (RLGL.State.currentTextureId != RLGL.State.defaultTextureId)? RLGL.State.currentTextureId : 0;
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    int *shaderLocs = RLGL.State.currentShaderLocs;
+    int blendMode = RLGL.State.currentBlendMode;
+#else
+    unsigned int textureId = ((RLGL.Cache.texture2D == 1) && (RLGL.Cache.textureId[0] > 0))? (unsigned int)RLGL.Cache.textureId[0] : 0;
+#endif
+
+    for (int i = 0; i < rlSubmittedCommandListsCount; i++) rlDrawCommandList(rlSubmittedCommandLists[i]);
+
+    rlSubmittedCommandListsCount = 0;
+
+    rlSetTexture(textureId);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSetShader(shaderId, shaderLocs);
+    rlSetBlendMode(blendMode);
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3253,7 +3877,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlBindTexture2D(0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3300,7 +3924,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3389,13 +4013,21 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipmapCount); // Required for user-defined mip count
     }
 #endif
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+#endif
 
     // At this point we have the texture loaded in GPU and texture parameters configured
 
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3431,7 +4063,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlBindTexture2D(id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3439,7 +4071,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlBindTexture2D(0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3455,6 +4087,19 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
     }
+#elif defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // NOTE: Software renderer has no renderbuffers, a depth texture is always created
+    // Its storage uses the software depth buffer layout (SW_DEPTH_BUFFER_BITS)
+    glGenTextures(1, &id);
+    rlBindTexture2D(id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    rlBindTexture2D(0);
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth texture loaded successfully", id);
 #endif
 
     return id;
@@ -3561,7 +4206,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3650,14 +4295,20 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+    // NOTE: Deleted texture is unbound from texture slots, binding reverts to 0
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        if (RLGL.Cache.textureId[i] == (int)id) RLGL.Cache.textureId[i] = 0;
+    }
 }
 
 // Generate mipmap data for selected texture
-// NOTE: Only supports GPU mipmap generation
+// NOTE: Only supports GPU mipmap generation, or CPU generation with the software renderer
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3678,7 +4329,17 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
+#elif defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlBindTexture2D(id);
+
+    // NOTE: Software renderer generates the levels on CPU (RGBA8), NPOT textures are supported
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    *mipmaps = 1 + (int)floor(log((width > height)? width : height)/log(2));
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+
+    rlBindTexture2D(0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3690,7 +4351,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3716,7 +4377,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3730,7 +4391,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer();
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3757,11 +4418,89 @@ void rlCopyFramebuffer(int x, int y, int width, int height, int format, void* pi
     swCopyFramebuffer(x, y, width, height, glFormat, glType, pixels);
 }
 
+// Copy framebuffer region pixel data to a buffer with rowLength pixels per row
+// NOTE: Useful to update only the modified region of a bigger (pitched) buffer
+void rlCopyFramebufferRegion(int x, int y, int width, int height, int format, int rowLength, void *pixels)
+{
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType); // Get OpenGL texture format
+    swPixelStorei(SW_PACK_ROW_LENGTH, rowLength);
+    swCopyFramebuffer(x, y, width, height, glFormat, glType, pixels);
+    swPixelStorei(SW_PACK_ROW_LENGTH, 0);
+}
+
 // Resize internal framebuffer
 void rlResizeFramebuffer(int width, int height)
 {
     swResizeFramebuffer(width, height);
 }
+
+// Get framebuffer region modified since last reset, false if unmodified
+// NOTE: Region is the union of the drawn primitives bounds, in framebuffer rows (top-down)
+bool rlGetFramebufferDirtyRect(int *x, int *y, int *width, int *height)
+{
+    return swGetDirtyRect(x, y, width, height);
+}
+
+// Reset framebuffer modified region tracking
+void rlResetFramebufferDirtyRect(void)
+{
+    swResetDirtyRect();
+}
+
+// Enable partial clear, only the region drawn since last clear gets cleared
+// NOTE: Only applies when clearing with same values than previous clear
+void rlEnablePartialClear(void)
+{
+    swEnable(SW_PARTIAL_CLEAR);
+}
+
+// Disable partial clear
+void rlDisablePartialClear(void)
+{
+    swDisable(SW_PARTIAL_CLEAR);
+}
+
+// Enable anti-aliasing, replacing MSAA on the software renderer
+// NOTE: Edges are anti-aliased at the end of every draw call, shared edges of a draw call are left untouched
+void rlEnableAntialiasing(void)
+{
+    swEnable(SW_MULTISAMPLE);
+}
+
+// Disable anti-aliasing
+void rlDisableAntialiasing(void)
+{
+    swDisable(SW_MULTISAMPLE);
+}
+
+// Get software renderer statistics since last reset
+// NOTE: Useful to log per frame if reset after every frame, i.e. to know if it is vertex, clip or fill bound
+rlSoftwareStats rlGetSoftwareStats(void)
+{
+    SWstats swStats = { 0 };
+    swGetStats(&swStats);
+
+    rlSoftwareStats stats = { 0 };
+    stats.primitivesSubmitted = swStats.primitivesSubmitted;
+    stats.primitivesClipped = swStats.primitivesClipped;
+    stats.primitivesCulled = swStats.primitivesCulled;
+    stats.fragmentsShaded = swStats.fragmentsShaded;
+    stats.fragmentsDepthRejected = swStats.fragmentsDepthRejected;
+    stats.fragmentsBlended = swStats.fragmentsBlended;
+    stats.texelsFetched = swStats.texelsFetched;
+    stats.clearTime = swStats.clearTime;
+    stats.rasterTime = swStats.rasterTime;
+    stats.copyTime = swStats.copyTime;
+
+    return stats;
+}
+
+// Reset software renderer statistics
+void rlResetSoftwareStats(void)
+{
+    swResetStats();
+}
 #endif
 
 // Read screen pixel data (color buffer)
@@ -3769,6 +4508,21 @@ unsigned char *rlReadScreenPixels(int width, int height)
 {
     unsigned char *imgData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
 
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // NOTE: Software renderer main framebuffer is stored top-down in rlsw memory,
+    // pixels are copied straight from it and no vertical flip is required
+    swCopyFramebuffer(0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, imgData);
+
+    for (int i = 0; i < width*height*4; i += 4)
+    {
+    #if SW_GL_FRAMEBUFFER_COPY_BGRA
+        unsigned char b = imgData[i];
+        imgData[i] = imgData[i + 2];
+        imgData[i + 2] = b;
+    #endif
+        imgData[i + 3] = 255; // Set alpha component value to 255 (no trasparent image retrieval)
+    }
+#else
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
     glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
@@ -3797,6 +4551,7 @@ unsigned char *rlReadScreenPixels(int width, int height)
             imgData[e+3] = 255; // Ditto
         }
     }
+#endif
 
     return imgData;     // NOTE: image data should be freed
 }
@@ -3809,7 +4564,7 @@ unsigned int rlLoadFramebuffer(void)
 {
     unsigned int fboId = 0;
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGenFramebuffers(1, &fboId);       // Create the framebuffer object
     glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
 #endif
@@ -3852,6 +4607,25 @@ void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType,
         default: break;
     }
 
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#elif defined(GRAPHICS_API_OPENGL_11_SOFTWARE) && defined(RLGL_RENDER_TEXTURES_HINT)
+    // NOTE: Software renderer supports one color texture and a depth texture (depth renderbuffers are textures)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texId, mipLevel);
+            else TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Software renderer only supports 2D color textures", fboId);
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if ((texType == RL_ATTACHMENT_TEXTURE2D) || (texType == RL_ATTACHMENT_RENDERBUFFER)) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+        } break;
+        default: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Attachment type not supported by software renderer", fboId); break;
+    }
+
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
@@ -3861,7 +4635,7 @@ bool rlFramebufferComplete(unsigned int id)
 {
     bool result = false;
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
 
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
@@ -3905,7 +4679,7 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);    // Keeps state cache texture slots in sync
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
@@ -3914,6 +4688,19 @@ void rlUnloadFramebuffer(unsigned int id)
     glDeleteFramebuffers(1, &id);
 
     TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#elif defined(GRAPHICS_API_OPENGL_11_SOFTWARE) && defined(RLGL_RENDER_TEXTURES_HINT)
+    // Query depth attachment to automatically delete texture, software renderer has no renderbuffers
+    int depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthIdU > 0) rlUnloadTexture(depthIdU);   // Keeps state cache texture slots in sync
+
+    glDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from RAM (software)", id);
 #endif
 }
 
@@ -4372,6 +5159,7 @@ void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
+    if (RLGL.Cache.shaderId == (int)id) RLGL.Cache.shaderId = -1; // Program id could be reused
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
@@ -4506,7 +5294,9 @@ void rlSetShader(unsigned int id, int *locs)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.State.batchSorting) rlBatchStateChanged();
+        else rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
     }
@@ -5083,7 +5873,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlDisableShader();
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -5097,6 +5887,433 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Set blend factors and equation for a blend mode
+static void rlSetBlendModeState(int mode)
+{
+    // NOTE: Custom blend factors could have changed, custom modes are always set
+    bool customBlend = (mode == RL_BLEND_CUSTOM) || (mode == RL_BLEND_CUSTOM_SEPARATE);
+    if (customBlend) RLGL.Cache.blendMode = mode;
+    else if (!rlUpdateStateCache(&RLGL.Cache.blendMode, mode)) return;
+
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+        } break;
+        default: break;
+    }
+}
+
+// Set shader for batch drawing, uploading current matrices
+static void rlSetBatchShader(unsigned int id, int *locs)
+{
+    rlEnableShader(id);
+
+    // Create modelview-projection matrix and upload to shader
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+
+    if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+    }
+
+    // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
+    // transformations and rendering occur between rlPushMatrix() and rlPopMatrix()
+
+    if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+    }
+
+    // Setup some default shader values
+    glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+}
+
+// Register a state change on current batch, starting a new draw call
+// NOTE: Used with batch sorting instead of drawing the batch, the new draw captures the state with its first vertex
+static void rlBatchStateChanged(void)
+{
+    rlRenderBatch *batch = RLGL.currentBatch;
+    rlDrawCall *draw = &batch->draws[batch->drawCounter - 1];
+
+    if (draw->vertexCount == 0) return;
+
+    int mode = draw->mode;
+    unsigned int textureId = draw->textureId;
+
+    // Make sure current draw vertexCount is aligned a multiple of 4, like on texture changes
+    if (mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+    else if (mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+    else draw->vertexAlignment = 0;
+
+    if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+    {
+        RLGL.State.vertexCounter += draw->vertexAlignment;
+        batch->drawCounter++;
+    }
+
+    if ((batch->drawCounter >= batch->drawCapacity) && !rlGrowRenderBatchDraws(batch)) rlDrawRenderBatch(batch);
+
+    // Next draw continues with same mode and texture
+    batch->draws[batch->drawCounter - 1].mode = mode;
+    batch->draws[batch->drawCounter - 1].textureId = textureId;
+    batch->draws[batch->drawCounter - 1].vertexCount = 0;
+}
+
+// Reorder batch draw calls by state, merging compatible ones
+// NOTE: A draw is moved back to the last draw with the same state (mode, texture, shader, blend mode, scissor)
+// only if it does not overlap on screen any of the draws it jumps over, so drawing order is kept where visible
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    rlDrawCall *draws = batch->draws;
+    int drawCount = batch->drawCounter;
+
+    // Sorting data by draw, kept between batch draws (default batch draw calls array could grow)
+    if (RLGL.State.sortDrawsCapacity < drawCount)
+    {
+        int *sortDraws = (int *)RL_REALLOC(RLGL.State.sortDraws, batch->drawCapacity*8*sizeof(int));
+        if (sortDraws == NULL) return;
+
+        RLGL.State.sortDraws = sortDraws;
+        RLGL.State.sortDrawsCapacity = batch->drawCapacity;
+    }
+
+    int *offset = RLGL.State.sortDraws;             // Draw vertex offset on current data
+    int *next = offset + drawCount;                 // Next draw of the same group, -1 for the last one
+    int *groupFirst = next + drawCount;             // First draw of every group
+    int *groupLast = groupFirst + drawCount;        // Last draw of every group
+    float (*groupRect)[4] = (float (*)[4])(groupLast + drawCount); // Screen rectangle covered by every group (NDC)
+    int groupCount = 0;
+
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+
+    for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+    {
+        offset[i] = vertexOffset;
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+        next[i] = -1;
+
+        if (draws[i].vertexCount == 0) continue;
+
+        // Project draw bounds corners to get the screen rectangle covered
+        float rect[4] = { 1e30f, 1e30f, -1e30f, -1e30f };
+        for (int c = 0; c < 8; c++)
+        {
+            float x = draws[i].bounds[(c & 1)? 3 : 0];
+            float y = draws[i].bounds[(c & 2)? 4 : 1];
+            float z = draws[i].bounds[(c & 4)? 5 : 2];
+
+            float cx = matMVP.m0*x + matMVP.m4*y + matMVP.m8*z + matMVP.m12;
+            float cy = matMVP.m1*x + matMVP.m5*y + matMVP.m9*z + matMVP.m13;
+            float cw = matMVP.m3*x + matMVP.m7*y + matMVP.m11*z + matMVP.m15;
+
+            // Corners behind the camera could cover any part of the screen
+            if (cw <= 0.000001f) { rect[0] = rect[1] = -1e30f; rect[2] = rect[3] = 1e30f; break; }
+
+            cx /= cw;
+            cy /= cw;
+            if (cx < rect[0]) rect[0] = cx;
+            if (cy < rect[1]) rect[1] = cy;
+            if (cx > rect[2]) rect[2] = cx;
+            if (cy > rect[3]) rect[3] = cy;
+        }
+
+        // Look for a previous group with the same state, not crossing any overlapping group
+        int group = -1;
+        for (int g = groupCount - 1; g >= 0; g--)
+        {
+            rlDrawCall *first = &draws[groupFirst[g]];
+
+            if ((first->mode == draws[i].mode) && (first->textureId == draws[i].textureId) &&
+                (first->shaderId == draws[i].shaderId) && (first->blendMode == draws[i].blendMode) &&
+                (first->scissorTest == draws[i].scissorTest) && (!first->scissorTest ||
+                ((first->scissor[0] == draws[i].scissor[0]) && (first->scissor[1] == draws[i].scissor[1]) &&
+                 (first->scissor[2] == draws[i].scissor[2]) && (first->scissor[3] == draws[i].scissor[3]))))
+            {
+                group = g;
+                break;
+            }
+
+            // NOTE: Filled shapes only sharing an edge do not cover the same pixels (rasterization rules),
+            // but lines are rasterized over their bounds edges, so touching them is overlapping
+            if ((draws[i].mode == RL_LINES) || (first->mode == RL_LINES))
+            {
+                if ((rect[0] <= groupRect[g][2]) && (rect[2] >= groupRect[g][0]) &&
+                    (rect[1] <= groupRect[g][3]) && (rect[3] >= groupRect[g][1])) break;
+            }
+            else if ((rect[0] < groupRect[g][2]) && (rect[2] > groupRect[g][0]) &&
+                     (rect[1] < groupRect[g][3]) && (rect[3] > groupRect[g][1])) break;
+        }
+
+        if (group == -1)
+        {
+            group = groupCount++;
+            groupFirst[group] = i;
+            groupRect[group][0] = rect[0];
+            groupRect[group][1] = rect[1];
+            groupRect[group][2] = rect[2];
+            groupRect[group][3] = rect[3];
+        }
+        else
+        {
+            next[groupLast[group]] = i;
+            if (rect[0] < groupRect[group][0]) groupRect[group][0] = rect[0];
+            if (rect[1] < groupRect[group][1]) groupRect[group][1] = rect[1];
+            if (rect[2] > groupRect[group][2]) groupRect[group][2] = rect[2];
+            if (rect[3] > groupRect[group][3]) groupRect[group][3] = rect[3];
+        }
+
+        groupLast[group] = i;
+    }
+
+    // Nothing to merge, keep draws as they are
+    int usedDraws = 0;
+    for (int i = 0; i < drawCount; i++) if (draws[i].vertexCount > 0) usedDraws++;
+    if (groupCount == usedDraws) return;
+
+    // Every group starts aligned to 4 vertex (quads indexing), check new layout fits in the buffer
+    int vertexTotal = 0;
+    for (int g = 0; g < groupCount; g++)
+    {
+        vertexTotal = (vertexTotal + 3) & ~3;
+        for (int i = groupFirst[g]; i != -1; i = next[i]) vertexTotal += draws[i].vertexCount;
+    }
+
+    if (vertexTotal > buffer->elementCount*4) return;
+
+    // Vertex data streams of the buffer: pointer and size of one vertex
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    unsigned char *streams[1] = { (unsigned char *)buffer->data };
+    const int streamSize[1] = { sizeof(rlBatchVertex) };
+    const int streamCount = 1;
+#else
+    unsigned char *streams[4] = { (unsigned char *)buffer->vertices, (unsigned char *)buffer->texcoords, (unsigned char *)buffer->normals, buffer->colors };
+    const int streamSize[4] = { 3*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(unsigned char) };
+    const int streamCount = 4;
+#endif
+
+    int vertexBytes = 0;
+    for (int k = 0; k < streamCount; k++) vertexBytes += streamSize[k];
+
+    int requiredSize = RLGL.State.vertexCounter*vertexBytes;
+    if (RLGL.State.sortBufferSize < requiredSize)
+    {
+        unsigned char *sortBuffer = (unsigned char *)RL_REALLOC(RLGL.State.sortBuffer, buffer->elementCount*4*vertexBytes);
+        if (sortBuffer == NULL) return;
+
+        RLGL.State.sortBuffer = sortBuffer;
+        RLGL.State.sortBufferSize = buffer->elementCount*4*vertexBytes;
+    }
+
+    // Copy current vertex data, then gather it back in groups order
+    unsigned char *source[4] = { 0 };
+    for (int k = 0, copyOffset = 0; k < streamCount; k++)
+    {
+        source[k] = RLGL.State.sortBuffer + copyOffset;
+        memcpy(source[k], streams[k], RLGL.State.vertexCounter*streamSize[k]);
+        copyOffset += RLGL.State.vertexCounter*streamSize[k];
+    }
+
+    int vertexOffset = 0;
+    for (int g = 0; g < groupCount; g++)
+    {
+        int groupOffset = (vertexOffset + 3) & ~3;
+        if (g > 0) draws[g - 1].vertexAlignment = groupOffset - vertexOffset;
+        vertexOffset = groupOffset;
+
+        int vertexCount = 0;
+        for (int i = groupFirst[g]; i != -1; i = next[i])
+        {
+            for (int k = 0; k < streamCount; k++)
+            {
+                memcpy(streams[k] + (vertexOffset + vertexCount)*streamSize[k], source[k] + offset[i]*streamSize[k], draws[i].vertexCount*streamSize[k]);
+            }
+
+            vertexCount += draws[i].vertexCount;
+        }
+
+        // NOTE: First draw of group g is never before draw g, groups are written over already gathered draws
+        draws[g] = draws[groupFirst[g]];
+        draws[g].vertexCount = vertexCount;
+        draws[g].vertexAlignment = 0;
+        vertexOffset += vertexCount;
+    }
+
+    batch->drawCounter = groupCount;
+    RLGL.State.vertexCounter = vertexOffset;
+}
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+// Bind interleaved batch vertex buffer and setup attributes for current shader
+// NOTE: All attributes read from the same buffer, stride is the size of one vertex
+static void rlSetBatchVertexAttribs(const rlVertexBuffer *buffer)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+
+    // Vertex position (shader-location = 0)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    // Vertex texcoord (shader-location = 1)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    // Vertex normal (shader-location = 2)
+#if RL_DEFAULT_BATCH_VERTEX_NORMALS
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, normal));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+#else
+    // Normals not stored, shader reads the constant attribute value instead
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] != -1) glDisableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+#endif
+
+    // Vertex color (shader-location = 3)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+#endif
+
+// Resize render batch vertex buffer (RAM and VRAM), keeping its vertex data
+// NOTE: VRAM buffers are reallocated empty, vertex data is uploaded on batch drawing
+static void rlResizeRenderBatchBuffer(rlVertexBuffer *buffer, int elementCount)
+{
+    // Resize CPU (RAM) vertex arrays
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    buffer->data = (rlBatchVertex *)RL_REALLOC(buffer->data, elementCount*4*sizeof(rlBatchVertex));
+#else
+    buffer->vertices = (float *)RL_REALLOC(buffer->vertices, elementCount*3*4*sizeof(float));
+    buffer->texcoords = (float *)RL_REALLOC(buffer->texcoords, elementCount*2*4*sizeof(float));
+    buffer->normals = (float *)RL_REALLOC(buffer->normals, elementCount*3*4*sizeof(float));
+    buffer->colors = (unsigned char *)RL_REALLOC(buffer->colors, elementCount*4*4*sizeof(unsigned char));
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    buffer->indices = (unsigned int *)RL_REALLOC(buffer->indices, elementCount*6*sizeof(unsigned int));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    buffer->indices = (unsigned short *)RL_REALLOC(buffer->indices, elementCount*6*sizeof(unsigned short));
+#endif
+
+    // Init indices for the new elements
+    for (int k = buffer->elementCount; k < elementCount; k++)
+    {
+        buffer->indices[6*k] = 4*k;
+        buffer->indices[6*k + 1] = 4*k + 1;
+        buffer->indices[6*k + 2] = 4*k + 2;
+        buffer->indices[6*k + 3] = 4*k;
+        buffer->indices[6*k + 4] = 4*k + 2;
+        buffer->indices[6*k + 5] = 4*k + 3;
+    }
+
+    // Resize GPU (VRAM) buffers
+    if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId);
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*4*sizeof(rlBatchVertex), NULL, GL_DYNAMIC_DRAW);
+#else
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[3]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+#endif
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[4]);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, elementCount*6*sizeof(int), buffer->indices, GL_STATIC_DRAW);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, elementCount*6*sizeof(short), buffer->indices, GL_STATIC_DRAW);
+#endif
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    else glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    TRACELOG(RL_LOG_DEBUG, "RLGL: Render batch buffer resized from %i to %i elements", buffer->elementCount, elementCount);
+
+    buffer->elementCount = elementCount;
+}
+
+// Grow default render batch current buffer to fit vertex, returns true if they fit
+// NOTE: Custom batches keep the size they were loaded with
+static bool rlGrowRenderBatch(rlRenderBatch *batch, int vCount)
+{
+    bool fit = false;
+
+    if (batch == &RLGL.defaultBatch)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        int elementCount = buffer->elementCount;
+
+        while (((RLGL.State.vertexCounter + vCount) >= elementCount*4) && (elementCount < RL_BATCH_MAX_BUFFER_ELEMENTS)) elementCount *= 2;
+        if (elementCount > RL_BATCH_MAX_BUFFER_ELEMENTS) elementCount = RL_BATCH_MAX_BUFFER_ELEMENTS;
+
+        if (elementCount > buffer->elementCount) rlResizeRenderBatchBuffer(buffer, elementCount);
+
+        fit = ((RLGL.State.vertexCounter + vCount) < buffer->elementCount*4);
+    }
+
+    return fit;
+}
+
+// Grow default render batch draw calls array, returns true if grown
+// NOTE: Custom batches keep the size they were loaded with
+static bool rlGrowRenderBatchDraws(rlRenderBatch *batch)
+{
+    bool grown = false;
+
+    if ((batch == &RLGL.defaultBatch) && (batch->drawCapacity < RL_DEFAULT_BATCH_MAX_DRAWCALLS))
+    {
+        int drawCapacity = batch->drawCapacity*2;
+        if (drawCapacity > RL_DEFAULT_BATCH_MAX_DRAWCALLS) drawCapacity = RL_DEFAULT_BATCH_MAX_DRAWCALLS;
+
+        batch->draws = (rlDrawCall *)RL_REALLOC(batch->draws, drawCapacity*sizeof(rlDrawCall));
+
+        for (int i = batch->drawCapacity; i < drawCapacity; i++)
+        {
+            batch->draws[i] = (rlDrawCall){ 0 };
+            batch->draws[i].mode = RL_QUADS;
+            batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        }
+
+        batch->drawCapacity = drawCapacity;
+        grown = true;
+    }
+
+    return grown;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -5175,6 +6392,52 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Add a new command to command list, growing it if required
+static rlCommand *rlCommandListPush(rlCommandList *list, int type)
+{
+    if (list->commandCount >= list->commandCapacity)
+    {
+        list->commandCapacity *= 2;
+        list->commands = (rlCommand *)RL_REALLOC(list->commands, list->commandCapacity*sizeof(rlCommand));
+    }
+
+    rlCommand *command = &list->commands[list->commandCount];
+    command->type = type;
+    command->mode = 0;
+    command->id = 0;
+    command->locs = NULL;
+    command->vertexOffset = 0;
+    command->vertexCount = 0;
+
+    list->commandCount++;
+
+    return command;
+}
+
+// Update render state cache value, returns true if changed (OpenGL call required)
+static bool rlUpdateStateCache(int *state, int value)
+{
+    bool changed = (*state != value);
+
+    if (changed) *state = value;
+    else RLGL.Cache.skippedCalls++;
+
+    return changed;
+}
+
+// Bind texture to active slot, skipped if already bound
+// NOTE: Texture slots out of cache limits are not tracked
+static void rlBindTexture2D(unsigned int id)
+{
+    int slot = RLGL.Cache.activeTextureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_SLOTS))
+    {
+        if (rlUpdateStateCache(&RLGL.Cache.textureId[slot], (int)id)) glBindTexture(GL_TEXTURE_2D, id);
+    }
+    else glBindTexture(GL_TEXTURE_2D, id);
+}
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)